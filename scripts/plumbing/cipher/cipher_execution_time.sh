@@ -143,6 +143,13 @@ compute-file-median ()
 
         echo "${key}: ${median}" >> ${medians_file}
     done
+
+    # Implementations which draw random bytes report how many; the count
+    # does not vary from one sample to the next.
+    for key in EncryptRandomBytes DecryptRandomBytes
+    do
+        grep -m 1 ${key} ${samples_file} >> ${medians_file} || true
+    done
 }
 
 set-cpu-governor ()
@@ -219,6 +226,42 @@ EOF
 }
 
 
+# Read the random bytes counter of the given binary under gdb, on the
+# simulated architectures, where the program output is not available
+# Parameters:
+# 	$1 - the target binary file
+#	$2 - the gdb output file
+function simulate_random_bytes()
+{
+	local target_file=$1
+	local output_file=$2
+	local command_file=../../../../scripts/plumbing/cipher/execution_time/${SCRIPT_ARCHITECTURE,,}_random_bytes.gdb
+	local server_pid
+
+
+	case $SCRIPT_ARCHITECTURE in
+		$SCRIPT_ARCHITECTURE_AVR)
+			$SIMAVR_SIMULATOR -g -m atmega128 $target_file &> /dev/null &
+			server_pid=$!
+			$AVR_GDB -batch -x $command_file &> $output_file || true
+			;;
+		$SCRIPT_ARCHITECTURE_MSP)
+			local commands=(
+				"prog $target_file"
+				"simio add hwmult hwmult"
+				gdb
+			)
+			$MSPDEBUG_SIMULATOR -n sim "${commands[@]}" &> /dev/null &
+			server_pid=$!
+			$MSP_GDB -batch -x $command_file &> $output_file || true
+			;;
+	esac
+
+	kill -INT $server_pid 2> /dev/null || true
+	wait $server_pid || true
+}
+
+
 # Compute the execution time
 # Parameters:
 # 	$1 - the simulator output file
@@ -276,6 +319,19 @@ function compute_execution_time()
 }
 
 
+# Extract the number of random bytes drawn, for implementations reporting it
+# Parameters:
+# 	$1 - the program output file
+# 	$2 - the row identifier
+function compute_random_bytes()
+{
+	local output_file=$1
+	local row_identifier=$2
+
+	grep -a -m 1 $row_identifier $output_file | tr -d '\r ' | cut -d ':' -f 2 || true
+}
+
+
 echo "Begin cipher execution time - $(pwd)"
 
 
@@ -292,6 +348,8 @@ then
 fi
 
 
+e_random_bytes=
+d_random_bytes=
 eks_execution_time=0
 e_execution_time=0
 dks_execution_time=0
@@ -310,6 +368,8 @@ case $SCRIPT_ARCHITECTURE in
 		if [ -f $pc_output_file ] ; then
 			e_execution_time=$(compute_execution_time $pc_output_file 'EncryptCycleCount')
 			d_execution_time=$(compute_execution_time $pc_output_file 'DecryptCycleCount')
+			e_random_bytes=$(compute_random_bytes $pc_output_file 'EncryptRandomBytes')
+			d_random_bytes=$(compute_random_bytes $pc_output_file 'DecryptRandomBytes')
 		fi
 		;;
 
@@ -327,6 +387,13 @@ case $SCRIPT_ARCHITECTURE in
 		if [ -f $avr_execution_time_log_file ] ; then
 			total_execution_time=$(compute_execution_time $avr_execution_time_log_file 'main')
 		fi
+
+		avr_random_bytes_log_file=$SCRIPT_ARCHITECTURE$FILE_NAME_SEPARATOR$AVR_RANDOM_BYTES_LOG_FILE
+
+		simulate_random_bytes $file $avr_random_bytes_log_file
+
+		e_random_bytes=$(compute_random_bytes $avr_random_bytes_log_file 'EncryptRandomBytes')
+		d_random_bytes=$(compute_random_bytes $avr_random_bytes_log_file 'DecryptRandomBytes')
 		;;
 
 	$SCRIPT_ARCHITECTURE_MSP)
@@ -347,6 +414,13 @@ case $SCRIPT_ARCHITECTURE in
 		if [ -f $mspdebug_execution_time_log_file ] ; then
 			total_execution_time=$(compute_execution_time $mspdebug_execution_time_log_file 1)
 		fi
+
+		mspdebug_random_bytes_log_file=$SCRIPT_ARCHITECTURE$FILE_NAME_SEPARATOR$MSPDEBUG_RANDOM_BYTES_LOG_FILE
+
+		simulate_random_bytes $file $mspdebug_random_bytes_log_file
+
+		e_random_bytes=$(compute_random_bytes $mspdebug_random_bytes_log_file 'EncryptRandomBytes')
+		d_random_bytes=$(compute_random_bytes $mspdebug_random_bytes_log_file 'DecryptRandomBytes')
 		;;
 
 	$SCRIPT_ARCHITECTURE_ARM)
@@ -359,6 +433,8 @@ case $SCRIPT_ARCHITECTURE in
 		if [ -f $arm_serial_terminal_output_file ] ; then
 			e_execution_time=$(compute_execution_time $arm_serial_terminal_output_file 'EncryptCycleCount')
 			d_execution_time=$(compute_execution_time $arm_serial_terminal_output_file 'DecryptCycleCount')
+			e_random_bytes=$(compute_random_bytes $arm_serial_terminal_output_file 'EncryptRandomBytes')
+			d_random_bytes=$(compute_random_bytes $arm_serial_terminal_output_file 'DecryptRandomBytes')
 		fi
 		;;
 
@@ -372,6 +448,8 @@ case $SCRIPT_ARCHITECTURE in
 		if [ -f $nrf52840_serial_terminal_output_file ] ; then
 			e_execution_time=$(compute_execution_time $nrf52840_serial_terminal_output_file 'EncryptCycleCount')
 			d_execution_time=$(compute_execution_time $nrf52840_serial_terminal_output_file 'DecryptCycleCount')
+			e_random_bytes=$(compute_random_bytes $nrf52840_serial_terminal_output_file 'EncryptRandomBytes')
+			d_random_bytes=$(compute_random_bytes $nrf52840_serial_terminal_output_file 'DecryptRandomBytes')
 		fi
 		;;
 
@@ -385,6 +463,8 @@ case $SCRIPT_ARCHITECTURE in
 		if [ -f $stm32l053_serial_terminal_output_file ] ; then
 			e_execution_time=$(compute_execution_time $stm32l053_serial_terminal_output_file 'EncryptCycleCount')
 			d_execution_time=$(compute_execution_time $stm32l053_serial_terminal_output_file 'DecryptCycleCount')
+			e_random_bytes=$(compute_random_bytes $stm32l053_serial_terminal_output_file 'EncryptRandomBytes')
+			d_random_bytes=$(compute_random_bytes $stm32l053_serial_terminal_output_file 'DecryptRandomBytes')
 		fi
 		;;
 esac
@@ -393,6 +473,10 @@ esac
 # Dipslay results
 printf "%s %s" $e_execution_time $d_execution_time > $SCRIPT_OUTPUT
 
+if [ -n "$e_random_bytes" ] ; then
+	printf " %s %s" $e_random_bytes $d_random_bytes >> $SCRIPT_OUTPUT
+fi
+
 
 echo ""
 echo "End cipher execution time - $(pwd)"
@@ -34,9 +34,11 @@
 PC_OUTPUT_FILE=pc_execution_time.log
 
 AVR_EXECUTION_TIME_LOG_FILE=avr_execution_time.log
+AVR_RANDOM_BYTES_LOG_FILE=avr_random_bytes.log
 
 MSPDEBUG_EXECUTION_TIME_LOG_FILE=mspdebug_execution_time.log
 MSPDEBUG_EXECUTION_TIME_SECTIONS_LOG_FILE=mspdebug_execution_time_sections.log
+MSPDEBUG_RANDOM_BYTES_LOG_FILE=mspdebug_random_bytes.log
 
 MAKE_LOG_FILE=cipher_execution_time_make.log
 
@@ -33,6 +33,15 @@ get_code_time ()
     cut -d' ' -f1 ${results}
 }
 
+get_random_bytes ()
+{
+    local results=$1
+
+    # Layout:
+    # E D [RE RD], the last two for implementations drawing random bytes
+    cut -s -d' ' -f3 ${results}
+}
+
 felics-version ()
 {
     formats_dir=$(dirname ${BASH_SOURCE})
@@ -65,6 +74,8 @@ add_json_table_row ()
     local code_ram_file=$7
     local code_time_file=$8
 
+    local random_bytes=$(get_random_bytes ${code_time_file})
+
     cat <<EOF >> ${output_file}
         {
             "cipher_name": "${cipher_name}",
@@ -73,6 +84,14 @@ add_json_table_row ()
             "compiler_options": "${cipher_implementation_compiler_options}",
             "code_size": $(get_code_size ${code_size_file}),
             "code_ram": $(get_code_ram ${code_ram_file}),
+EOF
+
+    if [ -n "${random_bytes}" ]
+    then
+        echo "            \"random_bytes\": ${random_bytes}," >> ${output_file}
+    fi
+
+    cat <<EOF >> ${output_file}
             "code_time": $(get_code_time ${code_time_file})
         },
 EOF
@@ -0,0 +1,46 @@
+/*
+Ascon-p on bit-interleaved 32-bit words, see asconp32.h.
+
+Derived from the optimized 32-bit implementation of Ascon by Christoph
+Dobraunig and Martin Schläffer, and from the assembly rounds of the ISAP
+implementation optimized for ARMv6 and ARMv7 by Robert Primas.
+
+Modified in 2026 by FELICS-AE contributors: shared backend of the Ascon and
+ISAP-A implementations; one unrolled copy of the rounds, entered at the
+first round of Ascon-p[rounds].
+*/
+
+#include <stdint.h>
+
+#include "asconp.h"
+
+
+void ascon_permute(ascon_state *s, unsigned int rounds)
+{
+    uint32_t e[5], o[5];
+    int j;
+
+    for (j = 0; j < 5; j++)
+    {
+        e[j] = (uint32_t)s->x[j];
+        o[j] = (uint32_t)(s->x[j] >> 32);
+    }
+
+    switch (rounds)
+    {
+    case 12: ascon_round32(e, o, 0);    /* fall through */
+    case 11: ascon_round32(e, o, 1);    /* fall through */
+    case 10: ascon_round32(e, o, 2);    /* fall through */
+    case 9:  ascon_round32(e, o, 3);    /* fall through */
+    case 8:  ascon_round32(e, o, 4);    /* fall through */
+    case 7:  ascon_round32(e, o, 5);    /* fall through */
+    case 6:  ascon_round32(e, o, 6);    /* fall through */
+    case 5:  ascon_round32(e, o, 7);    /* fall through */
+    case 4:  ascon_round32(e, o, 8);    /* fall through */
+    case 3:  ascon_round32(e, o, 9);    /* fall through */
+    case 2:  ascon_round32(e, o, 10);   /* fall through */
+    case 1:  ascon_round32(e, o, 11);
+    }
+
+    for (j = 0; j < 5; j++) s->x[j] = (uint64_t)o[j] << 32 | e[j];
+}
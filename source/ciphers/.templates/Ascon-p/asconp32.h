@@ -0,0 +1,306 @@
+/*
+Ascon-p, the permutation of Ascon and ISAP-A, shared by the optimized Ascon
+and ISAP-A implementations.  This is the bit-interleaved 32-bit backend, see
+asconp64.h for the interface.
+
+Each 64-bit state word is held as two 32-bit halves: the even half (bits 0,
+2, ..., 62 of the word) in the low 32 bits and the odd half (bits 1, 3, ...,
+63) in the high 32 bits, so that the 64-bit rotations of the linear layer
+are 32-bit rotations of the halves.
+
+On ARMv7-M (Cortex-M3, M4), rounds are written in assembly, which uses the
+barrel shifter for the rotations; defining ASCONP_ARMV7M_ASM to 0 (e.g. with
+COMPILER_OPTIONS=-DASCONP_ARMV7M_ASM=0) selects the C rounds instead.
+
+On x86 with BMI2 (e.g. COMPILER_OPTIONS=-mbmi2 or -march=native), the
+conversions between words and integers use pext/pdep instead of shifts and
+masks; ASCONP_BMI2 overrides the choice.  The BMI2 instructions are
+microcoded on AMD processors before Zen 3, where they are slower.
+*/
+
+#ifndef ASCONP_H
+#define ASCONP_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifndef ASCONP_ARMV7M_ASM
+#if defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__)
+#define ASCONP_ARMV7M_ASM 1
+#else
+#define ASCONP_ARMV7M_ASM 0
+#endif
+#endif
+
+#ifndef ASCONP_BMI2
+#if defined(__BMI2__)
+#define ASCONP_BMI2 1
+#else
+#define ASCONP_BMI2 0
+#endif
+#endif
+
+#if ASCONP_BMI2
+#include <immintrin.h>
+#endif
+
+typedef struct
+{
+    uint64_t x[5];
+} ascon_state;
+
+#define ASCON_ROR32(x, n)   (((x) >> (n)) | ((x) << (32 - (n))))
+
+/* Moves the even bits of x to its low 16 bits, and the odd ones to its high 16 bits */
+static inline uint32_t ascon_unshuffle(uint32_t x)
+{
+    uint32_t t;
+
+    t = (x ^ (x >> 1)) & 0x22222222; x ^= t ^ (t << 1);
+    t = (x ^ (x >> 2)) & 0x0c0c0c0c; x ^= t ^ (t << 2);
+    t = (x ^ (x >> 4)) & 0x00f000f0; x ^= t ^ (t << 4);
+    t = (x ^ (x >> 8)) & 0x0000ff00; x ^= t ^ (t << 8);
+    return x;
+}
+
+/* Inverse of ascon_unshuffle() */
+static inline uint32_t ascon_shuffle(uint32_t x)
+{
+    uint32_t t;
+
+    t = (x ^ (x >> 8)) & 0x0000ff00; x ^= t ^ (t << 8);
+    t = (x ^ (x >> 4)) & 0x00f000f0; x ^= t ^ (t << 4);
+    t = (x ^ (x >> 2)) & 0x0c0c0c0c; x ^= t ^ (t << 2);
+    t = (x ^ (x >> 1)) & 0x22222222; x ^= t ^ (t << 1);
+    return x;
+}
+
+/* Word of the backend's representation for the 64-bit integer x */
+static inline uint64_t ascon_word(uint64_t x)
+{
+#if ASCONP_BMI2
+    uint32_t lo = (uint32_t)x, hi = (uint32_t)(x >> 32);
+    uint32_t e = _pext_u32(lo, 0x55555555) | _pext_u32(hi, 0x55555555) << 16;
+    uint32_t o = _pext_u32(lo, 0xaaaaaaaa) | _pext_u32(hi, 0xaaaaaaaa) << 16;
+#else
+    uint32_t lo = ascon_unshuffle((uint32_t)x);
+    uint32_t hi = ascon_unshuffle((uint32_t)(x >> 32));
+    uint32_t e = (lo & 0x0000ffff) | (hi << 16);
+    uint32_t o = (lo >> 16) | (hi & 0xffff0000);
+#endif
+
+    return (uint64_t)o << 32 | e;
+}
+
+/* 64-bit integer of the word w, inverse of ascon_word() */
+static inline uint64_t ascon_integer(uint64_t w)
+{
+    uint32_t e = (uint32_t)w, o = (uint32_t)(w >> 32);
+#if ASCONP_BMI2
+    uint32_t lo = _pdep_u32(e, 0x55555555) | _pdep_u32(o, 0xaaaaaaaa);
+    uint32_t hi = _pdep_u32(e >> 16, 0x55555555) | _pdep_u32(o >> 16, 0xaaaaaaaa);
+#else
+    uint32_t lo = ascon_shuffle((e & 0x0000ffff) | (o << 16));
+    uint32_t hi = ascon_shuffle((e >> 16) | (o & 0xffff0000));
+#endif
+
+    return (uint64_t)hi << 32 | lo;
+}
+
+/* Loads the 8 bytes at p, resp. the n < 8 bytes at p followed by zeros */
+static inline uint64_t ascon_load(const uint8_t *p)
+{
+    uint32_t hi = (uint32_t)p[0] << 24 | (uint32_t)p[1] << 16 | (uint32_t)p[2] << 8 | p[3];
+    uint32_t lo = (uint32_t)p[4] << 24 | (uint32_t)p[5] << 16 | (uint32_t)p[6] << 8 | p[7];
+
+    return ascon_word((uint64_t)hi << 32 | lo);
+}
+
+static inline uint64_t ascon_loadbytes(const uint8_t *p, size_t n)
+{
+    uint64_t x = 0;
+    size_t i;
+
+    for (i = 0; i < n; i++) x |= (uint64_t)p[i] << (56 - 8*i);
+    return ascon_word(x);
+}
+
+/* Stores the 8 bytes of w at p, resp. its first n < 8 bytes */
+static inline void ascon_store(uint8_t *p, uint64_t w)
+{
+    uint64_t x = ascon_integer(w);
+    int i;
+
+    for (i = 0; i < 8; i++) p[i] = (uint8_t)(x >> (56 - 8*i));
+}
+
+static inline void ascon_storebytes(uint8_t *p, uint64_t w, size_t n)
+{
+    uint64_t x = ascon_integer(w);
+    size_t i;
+
+    for (i = 0; i < n; i++) p[i] = (uint8_t)(x >> (56 - 8*i));
+}
+
+/* Clears the first n < 8 bytes of w */
+static inline uint64_t ascon_clearbytes(uint64_t w, size_t n)
+{
+    return n ? w & ascon_word(~(uint64_t)0 >> (8*n)) : w;
+}
+
+/* Padding byte 0x80 after the first n < 8 bytes */
+static inline uint64_t ascon_pad(size_t n)
+{
+    return ascon_word((uint64_t)0x80 << (56 - 8*n));
+}
+
+/* Round constants of Ascon-p[12]: even and odd halves */
+static const uint8_t ASCON_RC32[12][2] =
+{
+    {0xc, 0xc}, {0x9, 0xc}, {0xc, 0x9}, {0x9, 0x9}, {0x6, 0xc}, {0x3, 0xc},
+    {0x6, 0x9}, {0x3, 0x9}, {0xc, 0x6}, {0x9, 0x6}, {0xc, 0x3}, {0x9, 0x3}
+};
+
+#if !ASCONP_ARMV7M_ASM
+
+/* Substitution layer on the even or the odd halves x[] of the state words */
+static inline __attribute__((always_inline)) void ascon_sbox32(uint32_t x[5])
+{
+    uint32_t t0, t1, t2, t3, t4;
+
+    x[0] ^= x[4]; x[4] ^= x[3]; x[2] ^= x[1];
+    t0 = ~x[0] & x[1]; t1 = ~x[1] & x[2]; t2 = ~x[2] & x[3]; t3 = ~x[3] & x[4]; t4 = ~x[4] & x[0];
+    x[0] ^= t1; x[1] ^= t2; x[2] ^= t3; x[3] ^= t4; x[4] ^= t0;
+    x[1] ^= x[0]; x[0] ^= x[4]; x[3] ^= x[2]; x[2] = ~x[2];
+}
+
+#endif
+
+/*
+Round i (0 to 11) of Ascon-p[12] on the even halves e[] and odd halves o[].
+Always inlined, so that e[] and o[] stay in registers and the round
+constants are immediates also at -O2 and -Os.
+*/
+static inline __attribute__((always_inline)) void ascon_round32(uint32_t e[5], uint32_t o[5], unsigned int i)
+{
+    // Addition of round constant
+    e[2] ^= ASCON_RC32[i][0];
+    o[2] ^= ASCON_RC32[i][1];
+
+#if ASCONP_ARMV7M_ASM
+    uint32_t reg0, reg1, reg2, reg3;
+
+    __asm__ __volatile__(
+        "eor %[x0_e], %[x0_e], %[x4_e]\n\t"
+        "eor %[x0_o], %[x0_o], %[x4_o]\n\t"
+        "eor %[x4_e], %[x4_e], %[x3_e]\n\t"
+        "eor %[x4_o], %[x4_o], %[x3_o]\n\t"
+        "eor %[x2_e], %[x2_e], %[x1_e]\n\t"
+        "eor %[x2_o], %[x2_o], %[x1_o]\n\t"
+        "bic %[reg0], %[x0_e], %[x4_e]\n\t"
+        "bic %[reg1], %[x4_e], %[x3_e]\n\t"
+        "bic %[reg2], %[x2_e], %[x1_e]\n\t"
+        "bic %[reg3], %[x1_e], %[x0_e]\n\t"
+        "eor %[x2_e], %[x2_e], %[reg1]\n\t"
+        "eor %[x0_e], %[x0_e], %[reg2]\n\t"
+        "eor %[x4_e], %[x4_e], %[reg3]\n\t"
+        "bic %[reg3], %[x3_e], %[x2_e]\n\t"
+        "eor %[x3_e], %[x3_e], %[reg0]\n\t"
+        "bic %[reg2], %[x0_o], %[x4_o]\n\t"
+        "bic %[reg0], %[x2_o], %[x1_o]\n\t"
+        "bic %[reg1], %[x4_o], %[x3_o]\n\t"
+        "eor %[x1_e], %[x1_e], %[reg3]\n\t"
+        "eor %[x0_o], %[x0_o], %[reg0]\n\t"
+        "eor %[x2_o], %[x2_o], %[reg1]\n\t"
+        "bic %[reg3], %[x1_o], %[x0_o]\n\t"
+        "bic %[reg0], %[x3_o], %[x2_o]\n\t"
+        "eor %[x3_o], %[x3_o], %[reg2]\n\t"
+        "eor %[x3_o], %[x3_o], %[x2_o]\n\t"
+        "eor %[x4_o], %[x4_o], %[reg3]\n\t"
+        "eor %[x1_o], %[x1_o], %[reg0]\n\t"
+        "eor %[x3_e], %[x3_e], %[x2_e]\n\t"
+        "eor %[x1_e], %[x1_e], %[x0_e]\n\t"
+        "eor %[x1_o], %[x1_o], %[x0_o]\n\t"
+        "eor %[x0_e], %[x0_e], %[x4_e]\n\t"
+        "eor %[x0_o], %[x0_o], %[x4_o]\n\t"
+        "mvn %[x2_e], %[x2_e]\n\t"
+        "mvn %[x2_o], %[x2_o]\n\t"
+        "eor %[reg0], %[x0_e], %[x0_o], ror #4\n\t"
+        "eor %[reg1], %[x0_o], %[x0_e], ror #5\n\t"
+        "eor %[reg2], %[x1_e], %[x1_e], ror #11\n\t"
+        "eor %[reg3], %[x1_o], %[x1_o], ror #11\n\t"
+        "eor %[x0_e], %[x0_e], %[reg1], ror #9\n\t"
+        "eor %[x0_o], %[x0_o], %[reg0], ror #10\n\t"
+        "eor %[x1_e], %[x1_e], %[reg3], ror #19\n\t"
+        "eor %[x1_o], %[x1_o], %[reg2], ror #20\n\t"
+        "eor %[reg0], %[x2_e], %[x2_o], ror #2\n\t"
+        "eor %[reg1], %[x2_o], %[x2_e], ror #3\n\t"
+        "eor %[reg2], %[x3_e], %[x3_o], ror #3\n\t"
+        "eor %[reg3], %[x3_o], %[x3_e], ror #4\n\t"
+        "eor %[x2_e], %[x2_e], %[reg1]\n\t"
+        "eor %[x2_o], %[x2_o], %[reg0], ror #1\n\t"
+        "eor %[x3_e], %[x3_e], %[reg2], ror #5\n\t"
+        "eor %[x3_o], %[x3_o], %[reg3], ror #5\n\t"
+        "eor %[reg0], %[x4_e], %[x4_e], ror #17\n\t"
+        "eor %[reg1], %[x4_o], %[x4_o], ror #17\n\t"
+        "eor %[x4_e], %[x4_e], %[reg1], ror #3\n\t"
+        "eor %[x4_o], %[x4_o], %[reg0], ror #4\n\t"
+        : [x0_e] "+r"(e[0]), [x1_e] "+r"(e[1]),
+          [x2_e] "+r"(e[2]), [x3_e] "+r"(e[3]),
+          [x4_e] "+r"(e[4]), [x0_o] "+r"(o[0]),
+          [x1_o] "+r"(o[1]), [x2_o] "+r"(o[2]),
+          [x3_o] "+r"(o[3]), [x4_o] "+r"(o[4]),
+          [reg0] "=r"(reg0), [reg1] "=r"(reg1),
+          [reg2] "=r"(reg2), [reg3] "=r"(reg3)::);
+#else
+    uint32_t t0_e, t0_o, t1_e, t1_o, t2_e, t2_o, t3_e, t3_o, t4_e, t4_o;
+
+    // Substitution layer
+    ascon_sbox32(e);
+    ascon_sbox32(o);
+
+    // Linear diffusion layer: a 64-bit rotation by 2r (resp. 2r+1) is a
+    // rotation of both halves by r (resp. of the odd half by r and of the
+    // even half by r+1, swapping the halves)
+    t0_e = e[0] ^ ASCON_ROR32(o[0], 4);
+    t0_o = o[0] ^ ASCON_ROR32(e[0], 5);
+    t1_e = e[1] ^ ASCON_ROR32(e[1], 11);
+    t1_o = o[1] ^ ASCON_ROR32(o[1], 11);
+    t2_e = e[2] ^ ASCON_ROR32(o[2], 2);
+    t2_o = o[2] ^ ASCON_ROR32(e[2], 3);
+    t3_e = e[3] ^ ASCON_ROR32(o[3], 3);
+    t3_o = o[3] ^ ASCON_ROR32(e[3], 4);
+    t4_e = e[4] ^ ASCON_ROR32(e[4], 17);
+    t4_o = o[4] ^ ASCON_ROR32(o[4], 17);
+    e[0] ^= ASCON_ROR32(t0_o, 9);
+    o[0] ^= ASCON_ROR32(t0_e, 10);
+    e[1] ^= ASCON_ROR32(t1_o, 19);
+    o[1] ^= ASCON_ROR32(t1_e, 20);
+    e[2] ^= t2_o;
+    o[2] ^= ASCON_ROR32(t2_e, 1);
+    e[3] ^= ASCON_ROR32(t3_e, 5);
+    o[3] ^= ASCON_ROR32(t3_o, 5);
+    e[4] ^= ASCON_ROR32(t4_o, 3);
+    o[4] ^= ASCON_ROR32(t4_e, 4);
+#endif
+}
+
+/* Round i (0 to 11) of Ascon-p[12] */
+static inline void ascon_round(ascon_state *s, unsigned int i)
+{
+    uint32_t e[5], o[5];
+    int j;
+
+    for (j = 0; j < 5; j++)
+    {
+        e[j] = (uint32_t)s->x[j];
+        o[j] = (uint32_t)(s->x[j] >> 32);
+    }
+    ascon_round32(e, o, i);
+    for (j = 0; j < 5; j++) s->x[j] = (uint64_t)o[j] << 32 | e[j];
+}
+
+/* Ascon-p[rounds] (rounds from 1 to 12): rounds 12-rounds to 11 of Ascon-p[12] */
+void ascon_permute(ascon_state *s, unsigned int rounds);
+
+#endif /* ASCONP_H */
@@ -0,0 +1,37 @@
+/*
+Ascon-p on 64-bit words, see asconp64.h.
+
+Derived from the optimized 64-bit implementation of Ascon by Christoph
+Dobraunig and Martin Schläffer.
+
+Modified in 2026 by FELICS-AE contributors: shared backend of the Ascon and
+ISAP-A implementations; one unrolled copy of the rounds, entered at the
+first round of Ascon-p[rounds].
+*/
+
+#include <stdint.h>
+
+#include "asconp.h"
+
+
+void ascon_permute(ascon_state *s, unsigned int rounds)
+{
+    ascon_state t = *s;
+
+    switch (rounds)
+    {
+    case 12: ascon_round(&t, 0);    /* fall through */
+    case 11: ascon_round(&t, 1);    /* fall through */
+    case 10: ascon_round(&t, 2);    /* fall through */
+    case 9:  ascon_round(&t, 3);    /* fall through */
+    case 8:  ascon_round(&t, 4);    /* fall through */
+    case 7:  ascon_round(&t, 5);    /* fall through */
+    case 6:  ascon_round(&t, 6);    /* fall through */
+    case 5:  ascon_round(&t, 7);    /* fall through */
+    case 4:  ascon_round(&t, 8);    /* fall through */
+    case 3:  ascon_round(&t, 9);    /* fall through */
+    case 2:  ascon_round(&t, 10);   /* fall through */
+    case 1:  ascon_round(&t, 11);
+    }
+    *s = t;
+}
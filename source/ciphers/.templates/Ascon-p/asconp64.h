@@ -0,0 +1,116 @@
+/*
+Ascon-p, the permutation of Ascon and ISAP-A, shared by the optimized Ascon
+and ISAP-A implementations.  This is the 64-bit backend: state words are
+plain 64-bit integers.
+
+Every backend provides the same interface, in a header and a source file
+which implementations link as asconp.h and asconp.c:
+
+- asconp64.h, asconp64.c: 64-bit words, for 64-bit processors,
+- asconp32.h, asconp32.c: bit-interleaved 32-bit words, for 32-bit (and
+  smaller) processors; on ARMv7-M, rounds are written in assembly,
+- asconp_x4.h, asconp_x4.c: four states in the lanes of AVX2 registers, on
+  top of the 64-bit backend.
+
+State words are in the backend's representation: they must be converted
+with ascon_load(), ascon_store() and ascon_word() rather than written
+directly.  Bytes are in big-endian order, as in the Ascon specification.
+
+The vref implementations (Ascon-128_vref, Ascon-128a_vref, and the
+Ascon-reference.c of Isap-A-128a_vref) keep their own permutation: they are
+the designers' code as submitted, which the backends are checked against,
+and FELICS-AE keeps such code as close to the original as possible.
+*/
+
+#ifndef ASCONP_H
+#define ASCONP_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+typedef struct
+{
+    uint64_t x[5];
+} ascon_state;
+
+#define ASCON_ROTR(x, n)    (((x) >> (n)) | ((x) << (64 - (n))))
+
+/* Word of the backend's representation for the 64-bit integer x */
+static inline uint64_t ascon_word(uint64_t x)
+{
+    return x;
+}
+
+/* Loads the 8 bytes at p, resp. the n < 8 bytes at p followed by zeros */
+static inline uint64_t ascon_load(const uint8_t *p)
+{
+    return (uint64_t)p[0] << 56 | (uint64_t)p[1] << 48 | (uint64_t)p[2] << 40 | (uint64_t)p[3] << 32 |
+           (uint64_t)p[4] << 24 | (uint64_t)p[5] << 16 | (uint64_t)p[6] << 8 | (uint64_t)p[7];
+}
+
+static inline uint64_t ascon_loadbytes(const uint8_t *p, size_t n)
+{
+    uint64_t x = 0;
+    size_t i;
+
+    for (i = 0; i < n; i++) x |= (uint64_t)p[i] << (56 - 8*i);
+    return x;
+}
+
+/* Stores the 8 bytes of x at p, resp. its first n < 8 bytes */
+static inline void ascon_store(uint8_t *p, uint64_t x)
+{
+    int i;
+
+    for (i = 0; i < 8; i++) p[i] = (uint8_t)(x >> (56 - 8*i));
+}
+
+static inline void ascon_storebytes(uint8_t *p, uint64_t x, size_t n)
+{
+    size_t i;
+
+    for (i = 0; i < n; i++) p[i] = (uint8_t)(x >> (56 - 8*i));
+}
+
+/* Clears the first n < 8 bytes of x */
+static inline uint64_t ascon_clearbytes(uint64_t x, size_t n)
+{
+    return n ? x & (~(uint64_t)0 >> (8*n)) : x;
+}
+
+/* Padding byte 0x80 after the first n < 8 bytes */
+static inline uint64_t ascon_pad(size_t n)
+{
+    return (uint64_t)0x80 << (56 - 8*n);
+}
+
+/*
+Round i (0 to 11) of Ascon-p[12].  Always inlined, so that the state stays
+in registers across the rounds of ascon_permute() also at -O2 and -Os.
+*/
+static inline __attribute__((always_inline)) void ascon_round(ascon_state *s, unsigned int i)
+{
+    uint64_t x0 = s->x[0], x1 = s->x[1], x2 = s->x[2], x3 = s->x[3], x4 = s->x[4];
+    uint64_t t0, t1, t2, t3, t4;
+
+    // Addition of round constant
+    x2 ^= ((uint64_t)(0xf - i) << 4) | i;
+
+    // Substitution layer
+    x0 ^= x4; x4 ^= x3; x2 ^= x1;
+    t0 = ~x0 & x1; t1 = ~x1 & x2; t2 = ~x2 & x3; t3 = ~x3 & x4; t4 = ~x4 & x0;
+    x0 ^= t1; x1 ^= t2; x2 ^= t3; x3 ^= t4; x4 ^= t0;
+    x1 ^= x0; x0 ^= x4; x3 ^= x2; x2 = ~x2;
+
+    // Linear diffusion layer
+    s->x[0] = x0 ^ ASCON_ROTR(x0, 19) ^ ASCON_ROTR(x0, 28);
+    s->x[1] = x1 ^ ASCON_ROTR(x1, 61) ^ ASCON_ROTR(x1, 39);
+    s->x[2] = x2 ^ ASCON_ROTR(x2,  1) ^ ASCON_ROTR(x2,  6);
+    s->x[3] = x3 ^ ASCON_ROTR(x3, 10) ^ ASCON_ROTR(x3, 17);
+    s->x[4] = x4 ^ ASCON_ROTR(x4,  7) ^ ASCON_ROTR(x4, 41);
+}
+
+/* Ascon-p[rounds] (rounds from 1 to 12): rounds 12-rounds to 11 of Ascon-p[12] */
+void ascon_permute(ascon_state *s, unsigned int rounds);
+
+#endif /* ASCONP_H */
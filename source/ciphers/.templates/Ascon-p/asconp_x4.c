@@ -0,0 +1,25 @@
+/*
+Ascon-p on four states in AVX2 lanes, see asconp_x4.h.
+
+Written in 2026 by FELICS-AE contributors, from the AVX2 rounds of the
+vinterleaved implementation of ISAP-A-128a.
+*/
+
+#pragma GCC target("avx2")
+
+#include <stdint.h>
+#include <immintrin.h>
+
+#include "asconp_x4.h"
+
+
+void ascon_permute_x4(ascon_state_x4 *s, unsigned int rounds)
+{
+    __m256i x[5];
+    unsigned int i;
+    int j;
+
+    for (j = 0; j < 5; j++) x[j] = _mm256_loadu_si256((const __m256i *)s->x[j]);
+    for (i = 12 - rounds; i < 12; i++) ascon_round_x4(x, i);
+    for (j = 0; j < 5; j++) _mm256_storeu_si256((__m256i *)s->x[j], x[j]);
+}
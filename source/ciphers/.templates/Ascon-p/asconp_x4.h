@@ -0,0 +1,55 @@
+/*
+Ascon-p on four independent states, one per 64-bit lane of AVX2 registers,
+on top of the 64-bit backend (asconp64.h): state words, and the conversions
+to and from bytes, are those of that backend.
+
+Meant for processing independent inputs in batches, such as the re-keyings
+of ISAP.  Callers must check that the processor supports AVX2.
+*/
+
+#ifndef ASCONP_X4_H
+#define ASCONP_X4_H
+
+#include <stdint.h>
+#include <immintrin.h>
+
+#include "asconp.h"
+
+/* Word i of state l is x[i][l] */
+typedef struct
+{
+    uint64_t x[5][4];
+} ascon_state_x4;
+
+#define ASCON_VROTR(x, n)   _mm256_or_si256(_mm256_srli_epi64((x), (n)), _mm256_slli_epi64((x), 64 - (n)))
+
+/* Round i (0 to 11) of Ascon-p[12] on the four states in x[] */
+static inline __attribute__((always_inline, target("avx2"))) void ascon_round_x4(__m256i x[5], unsigned int i)
+{
+    __m256i x0 = x[0], x1 = x[1], x2 = x[2], x3 = x[3], x4 = x[4];
+    __m256i t0, t1, t2, t3, t4;
+
+    // Addition of round constant
+    x2 = _mm256_xor_si256(x2, _mm256_set1_epi64x(((0xf - i) << 4) | i));
+
+    // Substitution layer
+    x0 = _mm256_xor_si256(x0, x4); x4 = _mm256_xor_si256(x4, x3); x2 = _mm256_xor_si256(x2, x1);
+    t0 = _mm256_andnot_si256(x0, x1); t1 = _mm256_andnot_si256(x1, x2); t2 = _mm256_andnot_si256(x2, x3);
+    t3 = _mm256_andnot_si256(x3, x4); t4 = _mm256_andnot_si256(x4, x0);
+    x0 = _mm256_xor_si256(x0, t1); x1 = _mm256_xor_si256(x1, t2); x2 = _mm256_xor_si256(x2, t3);
+    x3 = _mm256_xor_si256(x3, t4); x4 = _mm256_xor_si256(x4, t0);
+    x1 = _mm256_xor_si256(x1, x0); x0 = _mm256_xor_si256(x0, x4); x3 = _mm256_xor_si256(x3, x2);
+    x2 = _mm256_xor_si256(x2, _mm256_set1_epi64x(-1));
+
+    // Linear diffusion layer
+    x[0] = _mm256_xor_si256(x0, _mm256_xor_si256(ASCON_VROTR(x0, 19), ASCON_VROTR(x0, 28)));
+    x[1] = _mm256_xor_si256(x1, _mm256_xor_si256(ASCON_VROTR(x1, 61), ASCON_VROTR(x1, 39)));
+    x[2] = _mm256_xor_si256(x2, _mm256_xor_si256(ASCON_VROTR(x2,  1), ASCON_VROTR(x2,  6)));
+    x[3] = _mm256_xor_si256(x3, _mm256_xor_si256(ASCON_VROTR(x3, 10), ASCON_VROTR(x3, 17)));
+    x[4] = _mm256_xor_si256(x4, _mm256_xor_si256(ASCON_VROTR(x4,  7), ASCON_VROTR(x4, 41)));
+}
+
+/* Ascon-p[rounds] (rounds from 1 to 12) on each of the four states */
+void ascon_permute_x4(ascon_state_x4 *s, unsigned int rounds);
+
+#endif /* ASCONP_X4_H */
@@ -0,0 +1,350 @@
+/*
+GIFT-128 fixsliced implementation, see gift128.h.
+
+Adapted from the fixsliced GIFT-128 of Alexandre Adomnicai, Zakaria Najm
+and Thomas Peyrin, in portable C: the first 20 round keys are computed in
+the classical representation and rearranged, the 60 others are computed
+directly in the fixsliced representations.
+*/
+
+#include <stdint.h>
+
+#include "gift128.h"
+
+#define ROR(x,y)            (((x) >> (y)) | ((x) << (32 - (y))))
+
+#define BYTE_ROR_2(x)       ((((x) >> 2) & 0x3f3f3f3f) | (((x) & 0x03030303) << 6))
+#define BYTE_ROR_4(x)       ((((x) >> 4) & 0x0f0f0f0f) | (((x) & 0x0f0f0f0f) << 4))
+#define BYTE_ROR_6(x)       ((((x) >> 6) & 0x03030303) | (((x) & 0x3f3f3f3f) << 2))
+#define HALF_ROR_4(x)       ((((x) >> 4) & 0x0fff0fff) | (((x) & 0x000f000f) << 12))
+#define HALF_ROR_8(x)       ((((x) >> 8) & 0x00ff00ff) | (((x) & 0x00ff00ff) << 8))
+#define HALF_ROR_12(x)      ((((x) >> 12)& 0x000f000f) | (((x) & 0x0fff0fff) << 4))
+#define NIBBLE_ROR_1(x)     ((((x) >> 1) & 0x77777777) | (((x) & 0x11111111) << 3))
+#define NIBBLE_ROR_2(x)     ((((x) >> 2) & 0x33333333) | (((x) & 0x33333333) << 2))
+#define NIBBLE_ROR_3(x)     ((((x) >> 3) & 0x11111111) | (((x) & 0x77777777) << 1))
+
+/* Swaps the bits of b selected by mask with the bits of a n positions above */
+#define SWAPMOVE(a, b, mask, n) do {            \
+    uint32_t tmp_ = ((b) ^ ((a) >> (n))) & (mask); \
+    (b) ^= tmp_;                                \
+    (a) ^= tmp_ << (n);                         \
+} while (0)
+
+#define SBOX(s0, s1, s2, s3) do {               \
+    s1 ^= s0 & s2;                              \
+    s0 ^= s1 & s3;                              \
+    s2 ^= s0 | s1;                              \
+    s3 ^= s2;                                   \
+    s1 ^= s3;                                   \
+    s3 ^= 0xffffffff;                           \
+    s2 ^= s0 & s1;                              \
+} while (0)
+
+/* Classical key update of the 32-bit word k1||k0: k1 >>> 2, k0 >>> 12 */
+#define KEY_UPDATE(x)                                                   \
+    ((((x) >> 12) & 0x0000000f) | (((x) & 0x00000fff) << 4) |          \
+     (((x) >> 2)  & 0x3fff0000) | (((x) & 0x00030000) << 14))
+
+/* Key updates in the fixsliced representation of rounds 5i+1 ... 5i+4 */
+#define KEY_TRIPLE_UPDATE_0(x)                                          \
+    (ROR((x) & 0x33333333, 24) | ROR((x) & 0xcccccccc, 16))
+
+#define KEY_DOUBLE_UPDATE_1(x)                                          \
+    ((((x) >> 4) & 0x0f000f00) | (((x) & 0x0f000f00) << 4) |           \
+     (((x) >> 6) & 0x00030003) | (((x) & 0x003f003f) << 2))
+
+#define KEY_TRIPLE_UPDATE_1(x)                                          \
+    ((((x) >> 6) & 0x03000300) | (((x) & 0x3f003f00) << 2) |           \
+     (((x) >> 5) & 0x00070007) | (((x) & 0x001f001f) << 3))
+
+#define KEY_DOUBLE_UPDATE_2(x)                                          \
+    (ROR((x) & 0xaaaaaaaa, 24) | ROR((x) & 0x55555555, 16))
+
+#define KEY_TRIPLE_UPDATE_2(x)                                          \
+    (ROR((x) & 0x55555555, 24) | ROR((x) & 0xaaaaaaaa, 20))
+
+#define KEY_DOUBLE_UPDATE_3(x)                                          \
+    ((((x) >> 2) & 0x03030303) | (((x) & 0x03030303) << 2) |           \
+     (((x) >> 1) & 0x70707070) | (((x) & 0x10101010) << 3))
+
+#define KEY_TRIPLE_UPDATE_3(x)                                          \
+    ((((x) >> 18) & 0x00003030) | (((x) & 0x01010101) << 3)  |         \
+     (((x) >> 14) & 0x0000c0c0) | (((x) & 0x0000e0e0) << 15) |         \
+     (((x) >> 1)  & 0x07070707) | (((x) & 0x00001010) << 19))
+
+#define KEY_DOUBLE_UPDATE_4(x)                                          \
+    ((((x) >> 4) & 0x0fff0000) | (((x) & 0x000f0000) << 12) |          \
+     (((x) >> 8) & 0x000000ff) | (((x) & 0x000000ff) << 8))
+
+#define KEY_TRIPLE_UPDATE_4(x)                                          \
+    ((((x) >> 6) & 0x03ff0000) | (((x) & 0x003f0000) << 10) |          \
+     (((x) >> 4) & 0x00000fff) | (((x) & 0x0000000f) << 12))
+
+/* Round constants in the fixsliced representation */
+static const uint32_t GIFT_RC[40] = {
+    0x10000008, 0x80018000, 0x54000002, 0x01010181,
+    0x8000001f, 0x10888880, 0x6001e000, 0x51500002,
+    0x03030180, 0x8000002f, 0x10088880, 0x60016000,
+    0x41500002, 0x03030080, 0x80000027, 0x10008880,
+    0x4001e000, 0x11500002, 0x03020180, 0x8000002b,
+    0x10080880, 0x60014000, 0x01400002, 0x02020080,
+    0x80000021, 0x10000080, 0x0001c000, 0x51000002,
+    0x03010180, 0x8000002e, 0x10088800, 0x60012000,
+    0x40500002, 0x01030080, 0x80000006, 0x10008808,
+    0xc001a000, 0x14500002, 0x01020181, 0x8000001a
+};
+
+static uint32_t load32_be(const uint8_t *p)
+{
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) |
+           ((uint32_t)p[2] << 8)  |  (uint32_t)p[3];
+}
+
+static void store32_be(uint8_t *p, uint32_t x)
+{
+    p[0] = (uint8_t)(x >> 24);
+    p[1] = (uint8_t)(x >> 16);
+    p[2] = (uint8_t)(x >> 8);
+    p[3] = (uint8_t)x;
+}
+
+static uint32_t load32_le(const uint8_t *p)
+{
+    return  (uint32_t)p[0]        | ((uint32_t)p[1] << 8) |
+           ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static void store32_le(uint8_t *p, uint32_t x)
+{
+    p[0] = (uint8_t)x;
+    p[1] = (uint8_t)(x >> 8);
+    p[2] = (uint8_t)(x >> 16);
+    p[3] = (uint8_t)(x >> 24);
+}
+
+/* ------------------------------------------------------------------------- */
+
+static uint32_t rearrange_rkey_0(uint32_t x)
+{
+    SWAPMOVE(x, x, 0x00550055, 9);
+    SWAPMOVE(x, x, 0x000f000f, 12);
+    SWAPMOVE(x, x, 0x00003333, 18);
+    SWAPMOVE(x, x, 0x000000ff, 24);
+    return x;
+}
+
+static uint32_t rearrange_rkey_1(uint32_t x)
+{
+    SWAPMOVE(x, x, 0x11111111, 3);
+    SWAPMOVE(x, x, 0x03030303, 6);
+    SWAPMOVE(x, x, 0x000f000f, 12);
+    SWAPMOVE(x, x, 0x000000ff, 24);
+    return x;
+}
+
+static uint32_t rearrange_rkey_2(uint32_t x)
+{
+    SWAPMOVE(x, x, 0x0000aaaa, 15);
+    SWAPMOVE(x, x, 0x00003333, 18);
+    SWAPMOVE(x, x, 0x0000f0f0, 12);
+    SWAPMOVE(x, x, 0x000000ff, 24);
+    return x;
+}
+
+static uint32_t rearrange_rkey_3(uint32_t x)
+{
+    SWAPMOVE(x, x, 0x0a0a0a0a, 3);
+    SWAPMOVE(x, x, 0x00cc00cc, 6);
+    SWAPMOVE(x, x, 0x0000f0f0, 12);
+    SWAPMOVE(x, x, 0x000000ff, 24);
+    return x;
+}
+
+/* rkey[0..3] hold k1||k0, k5||k4, k3||k2 and k7||k6 */
+static void precompute_rkeys(uint32_t *rkey)
+{
+    int i;
+
+    /* classical key schedule */
+    for (i = 0; i < 16; i += 2) {
+        rkey[i + 4] = rkey[i + 1];
+        rkey[i + 5] = KEY_UPDATE(rkey[i]);
+    }
+
+    /* transposition to fixsliced representations */
+    for (i = 0; i < 20; i += 10) {
+        rkey[i]     = rearrange_rkey_0(rkey[i]);
+        rkey[i + 1] = rearrange_rkey_0(rkey[i + 1]);
+        rkey[i + 2] = rearrange_rkey_1(rkey[i + 2]);
+        rkey[i + 3] = rearrange_rkey_1(rkey[i + 3]);
+        rkey[i + 4] = rearrange_rkey_2(rkey[i + 4]);
+        rkey[i + 5] = rearrange_rkey_2(rkey[i + 5]);
+        rkey[i + 6] = rearrange_rkey_3(rkey[i + 6]);
+        rkey[i + 7] = rearrange_rkey_3(rkey[i + 7]);
+    }
+
+    /* key schedule in fixsliced representations */
+    for (i = 20; i < 80; i += 10) {
+        rkey[i]     = rkey[i - 19];
+        rkey[i + 1] = KEY_TRIPLE_UPDATE_0(rkey[i - 20]);
+        rkey[i + 2] = KEY_DOUBLE_UPDATE_1(rkey[i - 17]);
+        rkey[i + 3] = KEY_TRIPLE_UPDATE_1(rkey[i - 18]);
+        rkey[i + 4] = KEY_DOUBLE_UPDATE_2(rkey[i - 15]);
+        rkey[i + 5] = KEY_TRIPLE_UPDATE_2(rkey[i - 16]);
+        rkey[i + 6] = KEY_DOUBLE_UPDATE_3(rkey[i - 13]);
+        rkey[i + 7] = KEY_TRIPLE_UPDATE_3(rkey[i - 14]);
+        rkey[i + 8] = KEY_DOUBLE_UPDATE_4(rkey[i - 11]);
+        rkey[i + 9] = KEY_TRIPLE_UPDATE_4(rkey[i - 12]);
+        SWAPMOVE(rkey[i], rkey[i], 0x00003333, 16);
+        SWAPMOVE(rkey[i], rkey[i], 0x55554444, 1);
+        SWAPMOVE(rkey[i + 1], rkey[i + 1], 0x55551100, 1);
+    }
+}
+
+/* Five rounds, after which the state is back in the classical representation */
+static void quintuple_round(uint32_t *s, const uint32_t *rkey, const uint32_t *rconst)
+{
+    uint32_t s0 = s[0], s1 = s[1], s2 = s[2], s3 = s[3];
+
+    SBOX(s0, s1, s2, s3);
+    s3 = NIBBLE_ROR_1(s3);
+    s1 = NIBBLE_ROR_2(s1);
+    s2 = NIBBLE_ROR_3(s2);
+    s1 ^= rkey[0];
+    s2 ^= rkey[1];
+    s0 ^= rconst[0];
+
+    SBOX(s3, s1, s2, s0);
+    s0 = HALF_ROR_4(s0);
+    s1 = HALF_ROR_8(s1);
+    s2 = HALF_ROR_12(s2);
+    s1 ^= rkey[2];
+    s2 ^= rkey[3];
+    s3 ^= rconst[1];
+
+    SBOX(s0, s1, s2, s3);
+    s3 = ROR(s3, 16);
+    s2 = ROR(s2, 16);
+    SWAPMOVE(s1, s1, 0x55555555, 1);
+    SWAPMOVE(s2, s2, 0x00005555, 1);
+    SWAPMOVE(s3, s3, 0x55550000, 1);
+    s1 ^= rkey[4];
+    s2 ^= rkey[5];
+    s0 ^= rconst[2];
+
+    SBOX(s3, s1, s2, s0);
+    s0 = BYTE_ROR_6(s0);
+    s1 = BYTE_ROR_4(s1);
+    s2 = BYTE_ROR_2(s2);
+    s1 ^= rkey[6];
+    s2 ^= rkey[7];
+    s3 ^= rconst[3];
+
+    SBOX(s0, s1, s2, s3);
+    s3 = ROR(s3, 24);
+    s1 = ROR(s1, 16);
+    s2 = ROR(s2, 8);
+    s1 ^= rkey[8];
+    s2 ^= rkey[9];
+    s0 ^= rconst[4];
+
+    s[0] = s3;
+    s[1] = s1;
+    s[2] = s2;
+    s[3] = s0;
+}
+
+static void encrypt_slices(uint32_t *s, const uint32_t *rkey)
+{
+    int i;
+
+    for (i = 0; i < 40; i += 5)
+        quintuple_round(s, rkey + 2*i, GIFT_RC + i);
+}
+
+/* ------------------------------------------------------------------------- */
+
+void giftb128_keyschedule(uint32_t rkey[GIFT128_RKEY_WORDS], const uint8_t key[16])
+{
+    rkey[0] = load32_be(key + 12);
+    rkey[1] = load32_be(key + 4);
+    rkey[2] = load32_be(key + 8);
+    rkey[3] = load32_be(key);
+    precompute_rkeys(rkey);
+}
+
+void giftb128_encrypt_block(uint8_t ctext[16], const uint32_t rkey[GIFT128_RKEY_WORDS], const uint8_t ptext[16])
+{
+    uint32_t s[4];
+
+    s[0] = load32_be(ptext);
+    s[1] = load32_be(ptext + 4);
+    s[2] = load32_be(ptext + 8);
+    s[3] = load32_be(ptext + 12);
+
+    encrypt_slices(s, rkey);
+
+    store32_be(ctext,      s[0]);
+    store32_be(ctext + 4,  s[1]);
+    store32_be(ctext + 8,  s[2]);
+    store32_be(ctext + 12, s[3]);
+}
+
+/* ------------------------------------------------------------------------- */
+
+/*
+The key of the specification is the one of giftb128 with its bytes reversed.
+*/
+void gift128_keyschedule(uint32_t rkey[GIFT128_RKEY_WORDS], const uint8_t key[16])
+{
+    rkey[0] = load32_le(key);
+    rkey[1] = load32_le(key + 8);
+    rkey[2] = load32_le(key + 4);
+    rkey[3] = load32_le(key + 12);
+    precompute_rkeys(rkey);
+}
+
+/* Bit 4n+j of each word to bit 8j+n */
+static uint32_t unzip_nibbles(uint32_t x)
+{
+    SWAPMOVE(x, x, 0x0a0a0a0a, 3);
+    SWAPMOVE(x, x, 0x00cc00cc, 6);
+    SWAPMOVE(x, x, 0x0000f0f0, 12);
+    SWAPMOVE(x, x, 0x0000ff00, 8);
+    return x;
+}
+
+static uint32_t zip_nibbles(uint32_t x)
+{
+    SWAPMOVE(x, x, 0x0000ff00, 8);
+    SWAPMOVE(x, x, 0x0000f0f0, 12);
+    SWAPMOVE(x, x, 0x00cc00cc, 6);
+    SWAPMOVE(x, x, 0x0a0a0a0a, 3);
+    return x;
+}
+
+/* Transposes the 4x4 matrix of the bytes of s[0..3] */
+static void transpose_bytes(uint32_t *s)
+{
+    SWAPMOVE(s[0], s[1], 0x00ff00ff, 8);
+    SWAPMOVE(s[2], s[3], 0x00ff00ff, 8);
+    SWAPMOVE(s[0], s[2], 0x0000ffff, 16);
+    SWAPMOVE(s[1], s[3], 0x0000ffff, 16);
+}
+
+void gift128_encrypt_block(uint8_t ctext[16], const uint32_t rkey[GIFT128_RKEY_WORDS], const uint8_t ptext[16])
+{
+    uint32_t s[4];
+    int i;
+
+    /* slice j holds bit j of the 32 nibbles */
+    for (i = 0; i < 4; i++)
+        s[i] = unzip_nibbles(load32_le(ptext + 4*i));
+    transpose_bytes(s);
+
+    encrypt_slices(s, rkey);
+
+    transpose_bytes(s);
+    for (i = 0; i < 4; i++)
+        store32_le(ctext + 4*i, zip_nibbles(s[i]));
+}
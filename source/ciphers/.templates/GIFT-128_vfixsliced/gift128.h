@@ -0,0 +1,34 @@
+/*
+GIFT-128 fixsliced implementation, shared by the vfixsliced implementations
+of GIFT-COFB, SUNDAE-GIFT and HyENA.
+
+Based on the fixsliced representation of GIFT by Alexandre Adomnicai,
+Zakaria Najm and Thomas Peyrin ("Fixslicing: A New GIFT Representation",
+TCHES 2020): each round keeps the state in the representation which makes
+its bit permutation cheapest, so that round keys and constants are
+precomputed in that same representation.
+*/
+
+#ifndef GIFT128_H
+#define GIFT128_H
+
+#include <stdint.h>
+
+/* Two round key words per round, for 40 rounds */
+#define GIFT128_RKEY_WORDS  80
+
+/*
+Bytes are loaded as in GIFT-COFB and SUNDAE-GIFT: the four 32-bit slices of
+the state (resp. the key words) are read in big-endian order.
+*/
+void giftb128_keyschedule(uint32_t rkey[GIFT128_RKEY_WORDS], const uint8_t key[16]);
+void giftb128_encrypt_block(uint8_t ctext[16], const uint32_t rkey[GIFT128_RKEY_WORDS], const uint8_t ptext[16]);
+
+/*
+Bytes are loaded as in the GIFT specification and HyENA: nibble 2i (resp.
+2i+1) of the state and of the key is the low (resp. high) nibble of byte i.
+*/
+void gift128_keyschedule(uint32_t rkey[GIFT128_RKEY_WORDS], const uint8_t key[16]);
+void gift128_encrypt_block(uint8_t ctext[16], const uint32_t rkey[GIFT128_RKEY_WORDS], const uint8_t ptext[16]);
+
+#endif /* GIFT128_H */
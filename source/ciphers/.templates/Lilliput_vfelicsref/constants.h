@@ -14,7 +14,8 @@ http://creativecommons.org/publicdomain/zero/1.0/
 
 ---
 
-This file provides bit and byte lengths for input and output parameters.
+This file provides bit and byte lengths for input and output parameters,
+as well as the number of tweakey lanes.
 */
 
 #ifndef CONSTANTS_H
@@ -38,4 +39,9 @@ This file provides bit and byte lengths for input and output parameters.
 #define NONCE_BYTES         (NONCE_LENGTH_BITS/8)
 #define TAG_BYTES           (TAG_LENGTH_BITS/8)
 
+/* Numbers of lanes in the tweakey, the tweak and the key. */
+#define LANES_NB       (TWEAKEY_BYTES/LANE_BYTES)
+#define TWEAK_LANES_NB (TWEAK_BYTES/LANE_BYTES)
+#define KEY_LANES_NB   (KEY_BYTES/LANE_BYTES)
+
 #endif
@@ -27,9 +27,6 @@ This file provides the implementation of Lilliput-TBC's tweakey schedule.
 #include "tweakey.h"
 
 
-#define LANES_NB (TWEAKEY_BYTES/LANE_BYTES)
-
-
 void tweakey_state_init(
     uint8_t TK[TWEAKEY_BYTES],
     const uint8_t key[KEY_BYTES],
@@ -0,0 +1,46 @@
+/*
+Implementation of the Lilliput-AE tweakable block cipher.
+
+Authors, hereby denoted as "the implementer":
+    Kévin Le Gouguec,
+    FELICS-AE contributors,
+    2026.
+
+For more information, feedback or questions, refer to our website:
+https://paclido.fr/lilliput-ae
+
+To the extent possible under law, the implementer has waived all copyright
+and related or neighboring rights to the source code in this file.
+http://creativecommons.org/publicdomain/zero/1.0/
+
+---
+
+This file provides the interface for Lilliput-TBC.
+
+Instead of the key, Lilliput-TBC takes the key lanes' contribution to
+every round tweakey, as computed by tweakey_precompute_key().
+*/
+
+#ifndef TBC_H
+#define TBC_H
+
+#include <stdint.h>
+
+#include "constants.h"
+
+
+void lilliput_tbc_encrypt(
+    const uint8_t RTK_key[ROUNDS][ROUND_TWEAKEY_BYTES],
+    const uint8_t tweak[TWEAK_BYTES],
+    const uint8_t message[BLOCK_BYTES],
+    uint8_t ciphertext[BLOCK_BYTES]
+);
+
+void lilliput_tbc_decrypt(
+    const uint8_t RTK_key[ROUNDS][ROUND_TWEAKEY_BYTES],
+    const uint8_t tweak[TWEAK_BYTES],
+    const uint8_t ciphertext[BLOCK_BYTES],
+    uint8_t message[BLOCK_BYTES]
+);
+
+#endif /* TBC_H */
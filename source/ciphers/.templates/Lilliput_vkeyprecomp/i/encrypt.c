@@ -0,0 +1,116 @@
+/*
+Implementation of the Lilliput-AE tweakable block cipher.
+
+Authors, hereby denoted as "the implementer":
+    Kévin Le Gouguec,
+    FELICS-AE contributors,
+    2026.
+
+For more information, feedback or questions, refer to our website:
+https://paclido.fr/lilliput-ae
+
+To the extent possible under law, the implementer has waived all copyright
+and related or neighboring rights to the source code in this file.
+http://creativecommons.org/publicdomain/zero/1.0/
+
+---
+
+This file implements Lilliput-AE's nonce-respecting mode based on ΘCB3.
+
+crypto_aead_encrypt() computes the key's contribution to the round
+tweakeys once, and the mode passes it down to every block instead of the
+key.
+*/
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "lilliput-ae-i.h"
+#include "cipher.h"
+#include "tweakey.h"
+
+
+static void _encrypt_message(
+    const uint8_t RTK_key[ROUNDS][ROUND_TWEAKEY_BYTES],
+    size_t        M_len,
+    const uint8_t M[M_len],
+    const uint8_t N[NONCE_BYTES],
+    uint8_t       C[M_len+BLOCK_BYTES],
+    uint8_t       Final[BLOCK_BYTES]
+)
+{
+    size_t l = M_len / BLOCK_BYTES;
+    size_t rest = M_len % BLOCK_BYTES;
+
+    RAM_DATA_BYTE tweak[TWEAK_BYTES];
+    _init_msg_tweak(N, tweak);
+
+    RAM_DATA_BYTE checksum[BLOCK_BYTES];
+    memset(checksum, 0, BLOCK_BYTES);
+
+    for (size_t j=0; j<l; j++)
+    {
+        xor_into(checksum, &M[j*BLOCK_BYTES]);
+        _fill_msg_tweak(0x0, j, tweak);
+        encrypt(RTK_key, tweak, &M[j*BLOCK_BYTES], &C[j*BLOCK_BYTES]);
+    }
+
+    if (rest == 0)
+    {
+        _fill_msg_tweak(0x1, l, tweak);
+        encrypt(RTK_key, tweak, checksum, Final);
+    }
+    else
+    {
+        RAM_DATA_BYTE M_rest[BLOCK_BYTES];
+        RAM_DATA_BYTE Pad[BLOCK_BYTES];
+
+        pad10(rest, &M[l*BLOCK_BYTES], M_rest);
+        xor_into(checksum, M_rest);
+
+        _fill_msg_tweak(0x4, l, tweak);
+        encrypt(RTK_key, tweak, _0n, Pad);
+        xor_arrays(rest, &C[l*BLOCK_BYTES], &M[l*BLOCK_BYTES], Pad);
+
+        _fill_msg_tweak(0x5, l+1, tweak);
+        encrypt(RTK_key, tweak, checksum, Final);
+    }
+}
+
+static void _lilliput_ae_encrypt(
+    size_t        message_len,
+    const uint8_t message[message_len],
+    size_t        auth_data_len,
+    const uint8_t auth_data[auth_data_len],
+    const uint8_t RTK_key[ROUNDS][ROUND_TWEAKEY_BYTES],
+    const uint8_t nonce[NONCE_BYTES],
+    uint8_t       ciphertext[message_len],
+    uint8_t       tag[TAG_BYTES]
+)
+{
+    RAM_DATA_BYTE auth[BLOCK_BYTES];
+    process_associated_data(RTK_key, auth_data_len, auth_data, auth);
+
+    RAM_DATA_BYTE final[BLOCK_BYTES];
+    _encrypt_message(RTK_key, message_len, message, nonce, ciphertext, final);
+
+    _generate_tag(final, auth, tag);
+}
+
+int crypto_aead_encrypt(
+	uint8_t *c, size_t *clen,
+	const uint8_t *m, size_t mlen,
+	const uint8_t *ad, size_t adlen,
+	const uint8_t *npub,
+	const uint8_t *k
+)
+{
+    RAM_DATA_BYTE RTK_key[ROUNDS][ROUND_TWEAKEY_BYTES];
+    tweakey_precompute_key(k, RTK_key);
+
+    _lilliput_ae_encrypt(mlen, m, adlen, ad, RTK_key, npub, c, c+mlen);
+    *clen = mlen + TAG_BYTES;
+
+    return 0;
+}
@@ -0,0 +1,166 @@
+/*
+Implementation of the Lilliput-AE tweakable block cipher.
+
+Authors, hereby denoted as "the implementer":
+    Kévin Le Gouguec,
+    FELICS-AE contributors,
+    2026.
+
+For more information, feedback or questions, refer to our website:
+https://paclido.fr/lilliput-ae
+
+To the extent possible under law, the implementer has waived all copyright
+and related or neighboring rights to the source code in this file.
+http://creativecommons.org/publicdomain/zero/1.0/
+
+---
+
+This file provides the implementation of Lilliput-TBC's tweakey schedule.
+
+The key lanes are only evolved once per key, to precompute their contribution
+to every round tweakey; the tweak lanes are evolved for every block.  All
+lanes are evolved as 64-bit words, so this file does not need the byte-wise
+multiplications of multiplications.h.
+*/
+
+#include <stdint.h>
+
+#include "felics/cipher.h"
+
+#include "constants.h"
+#include "tweakey.h"
+
+
+/* Lanes are evolved as 64-bit words, byte k of a lane being stored in bits 8k
+ * to 8k+7.  In this representation, M and M_R are a rotation by one byte
+ * XORed with three masked shifts. */
+
+static uint64_t _load_lane(const uint8_t lane[LANE_BYTES])
+{
+    uint64_t w = 0;
+
+    for (size_t k=0; k<LANE_BYTES; k++)
+    {
+        w |= (uint64_t)lane[k] << 8*k;
+    }
+
+    return w;
+}
+
+static uint64_t _multiply_M_word(uint64_t x)
+{
+    return (x << 8 | x >> 56)
+        ^ ((x << 3)  & 0x0000f80000000000) /* y[5] ^= x[5]<<3 */
+        ^ ((x >> 3)  & 0x0000001f00000000) /* y[4] ^= x[4]>>3 */
+        ^ ((x >> 30) & 0x0000000000fc0000); /* y[2] ^= x[6]<<2 */
+}
+
+static uint64_t _multiply_MR_word(uint64_t x)
+{
+    return (x >> 8 | x << 56)
+        ^ ((x >> 19) & 0x00000000001f0000) /* y[2] ^= x[4]>>3 */
+        ^ ((x >> 13) & 0x000000f800000000) /* y[4] ^= x[6]<<3 */
+        ^ ((x << 18) & 0x0000fc0000000000); /* y[5] ^= x[3]<<2 */
+}
+
+
+static void _key_lanes_update(uint64_t TK[KEY_LANES_NB])
+{
+    /* The first TWEAK_LANES_NB lanes hold the tweak: key lane j is lane
+     * TWEAK_LANES_NB+j, multiplied by M^(lane+1) for lanes 0 to 3 and by
+     * M_R^(lane-3) for lanes 4 to 6. */
+    for (size_t j=0; j<KEY_LANES_NB; j++)
+    {
+        size_t lane = TWEAK_LANES_NB + j;
+
+        if (lane < 4)
+        {
+            for (size_t n=0; n<lane+1; n++)
+            {
+                TK[j] = _multiply_M_word(TK[j]);
+            }
+        }
+        else
+        {
+            for (size_t n=0; n<lane-3; n++)
+            {
+                TK[j] = _multiply_MR_word(TK[j]);
+            }
+        }
+    }
+}
+
+void tweakey_precompute_key(
+    const uint8_t key[KEY_BYTES],
+    uint8_t RTK_key[ROUNDS][ROUND_TWEAKEY_BYTES]
+)
+{
+    uint64_t TK[KEY_LANES_NB];
+
+    for (size_t j=0; j<KEY_LANES_NB; j++)
+    {
+        TK[j] = _load_lane(key + j*LANE_BYTES);
+    }
+
+    for (size_t i=0; i<ROUNDS; i++)
+    {
+        /* The round constant is XORed into byte 0. */
+        uint64_t RTK = i;
+
+        for (size_t j=0; j<KEY_LANES_NB; j++)
+        {
+            RTK ^= TK[j];
+        }
+
+        for (size_t k=0; k<ROUND_TWEAKEY_BYTES; k++)
+        {
+            RTK_key[i][k] = (uint8_t)(RTK >> 8*k);
+        }
+
+        _key_lanes_update(TK);
+    }
+}
+
+
+void tweakey_state_init(
+    uint64_t TK[TWEAK_LANES_NB],
+    const uint8_t tweak[TWEAK_BYTES]
+)
+{
+    for (size_t j=0; j<TWEAK_LANES_NB; j++)
+    {
+        TK[j] = _load_lane(tweak + j*LANE_BYTES);
+    }
+}
+
+
+void tweakey_state_extract(
+    const uint64_t TK[TWEAK_LANES_NB],
+    const uint8_t RTK_key[ROUND_TWEAKEY_BYTES],
+    uint8_t round_tweakey[ROUND_TWEAKEY_BYTES]
+)
+{
+    uint64_t RTK = TK[0];
+
+    for (size_t j=1; j<TWEAK_LANES_NB; j++)
+    {
+        RTK ^= TK[j];
+    }
+
+    for (size_t k=0; k<ROUND_TWEAKEY_BYTES; k++)
+    {
+        round_tweakey[k] = RTK_key[k] ^ (uint8_t)(RTK >> 8*k);
+    }
+}
+
+
+void tweakey_state_update(uint64_t TK[TWEAK_LANES_NB])
+{
+    /* Lane j is multiplied by M^(j+1). */
+    TK[0] = _multiply_M_word(TK[0]);
+    TK[1] = _multiply_M_word(_multiply_M_word(TK[1]));
+
+#if TWEAK_LANES_NB >= 3
+    TK[2] = _multiply_M_word(_multiply_M_word(_multiply_M_word(TK[2])));
+#endif
+}
@@ -0,0 +1,52 @@
+/*
+Implementation of the Lilliput-AE tweakable block cipher.
+
+Authors, hereby denoted as "the implementer":
+    Kévin Le Gouguec,
+    FELICS-AE contributors,
+    2026.
+
+For more information, feedback or questions, refer to our website:
+https://paclido.fr/lilliput-ae
+
+To the extent possible under law, the implementer has waived all copyright
+and related or neighboring rights to the source code in this file.
+http://creativecommons.org/publicdomain/zero/1.0/
+
+---
+
+This file provides the interface for Lilliput-TBC's tweakey schedule.
+
+Each lane of the tweakey state evolves independently of the others, and each
+round tweakey is the XOR of all lanes: the contribution of the key lanes (and
+of the round constants) to every round tweakey can therefore be computed once
+per key, leaving only the tweak lanes to be evolved for each block.
+*/
+
+#ifndef TWEAKEY_H
+#define TWEAKEY_H
+
+#include <stdint.h>
+
+#include "constants.h"
+
+
+void tweakey_precompute_key(
+    const uint8_t key[KEY_BYTES],
+    uint8_t RTK_key[ROUNDS][ROUND_TWEAKEY_BYTES] /* output */
+);
+
+void tweakey_state_init(
+    uint64_t TK[TWEAK_LANES_NB],
+    const uint8_t tweak[TWEAK_BYTES]
+);
+
+void tweakey_state_extract(
+    const uint64_t TK[TWEAK_LANES_NB],
+    const uint8_t RTK_key[ROUND_TWEAKEY_BYTES],
+    uint8_t round_tweakey[ROUND_TWEAKEY_BYTES] /* output */
+);
+
+void tweakey_state_update(uint64_t TK[TWEAK_LANES_NB]);
+
+#endif /* TWEAKEY_H */
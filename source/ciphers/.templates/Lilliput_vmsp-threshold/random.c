@@ -0,0 +1 @@
+../Lilliput_vthreshold/random.c
\ No newline at end of file
@@ -32,7 +32,6 @@ tweakey schedule, where the tweak and the key are split into two shares.
 
 #define LANE_BITS  64
 #define LANE_BYTES (LANE_BITS/8)
-#define LANES_NB   (TWEAKEY_BYTES/LANE_BYTES)
 
 
 void tweakey_state_init(
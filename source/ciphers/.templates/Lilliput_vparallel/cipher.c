@@ -0,0 +1 @@
+../Lilliput_vfelicsref/cipher.c
\ No newline at end of file
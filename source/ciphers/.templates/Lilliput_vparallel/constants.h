@@ -0,0 +1 @@
+../Lilliput_vfelicsref/constants.h
\ No newline at end of file
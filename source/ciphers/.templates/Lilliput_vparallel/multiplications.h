@@ -0,0 +1 @@
+../Lilliput_vfelicsref/multiplications.h
\ No newline at end of file
@@ -0,0 +1,417 @@
+/*
+Implementation of the Lilliput-AE tweakable block cipher.
+
+Authors, hereby denoted as "the implementer":
+    Kévin Le Gouguec,
+    FELICS-AE contributors,
+    2026.
+
+For more information, feedback or questions, refer to our website:
+https://paclido.fr/lilliput-ae
+
+To the extent possible under law, the implementer has waived all copyright
+and related or neighboring rights to the source code in this file.
+http://creativecommons.org/publicdomain/zero/1.0/
+
+---
+
+This file provides a multi-block implementation of Lilliput-TBC.
+
+Blocks are byte-sliced: the state of up to 16 blocks is held in 16 SSE
+registers, where register j holds byte j of every block.  The linear and
+permutation layers thus become register XORs and renamings, and each round
+applies the 8-bit S-box of sbox-ssse3.h to 16 blocks at once, in constant
+time.
+
+The tweakey schedule is byte-sliced the same way, so that every block may use
+its own tweak.
+*/
+
+#pragma GCC target("ssse3")
+
+#include <stdint.h>
+#include <string.h>
+
+#include <tmmintrin.h>
+
+#include "felics/cipher.h"
+
+#include "constants.h"
+#include "sbox-ssse3.h"
+#include "parallel.h"
+
+
+#if PARALLEL_BLOCKS != BLOCK_BYTES
+#error "The byte-slicing transposition expects as many blocks as block bytes."
+#endif
+
+/* Byte j of every block. */
+typedef __m128i slice;
+
+
+static const uint8_t PI_ENCRYPTION[BLOCK_BYTES] = {
+    13,  9, 14,  8, 10, 11, 12, 15,  4,  5,  3,  1,  2,  6,  0,  7
+};
+
+static const uint8_t PI_DECRYPTION[BLOCK_BYTES] = {
+    14, 11, 12, 10,  8,  9, 13, 15,  3,  1,  4,  5,  6,  0,  2,  7
+};
+
+
+#define XOR(a, b) _mm_xor_si128((a), (b))
+
+/* Per-byte shifts; SSE only shifts 16-bit words, so mask out the bits which
+ * cross byte boundaries. */
+#define SHL(x, n) _mm_and_si128(_mm_slli_epi16((x), (n)), _mm_set1_epi8((char)(0xff<<(n))))
+#define SHR(x, n) _mm_and_si128(_mm_srli_epi16((x), (n)), _mm_set1_epi8((char)(0xff>>(n))))
+
+
+static void _transpose(slice X[BLOCK_BYTES])
+{
+    /* Each pass rotates the 8-bit (row, column) index of every byte by one
+     * bit; four passes swap rows and columns. */
+    for (size_t pass=0; pass<4; pass++)
+    {
+        slice Y[BLOCK_BYTES];
+
+        for (size_t i=0; i<8; i++)
+        {
+            Y[2*i]   = _mm_unpacklo_epi8(X[i], X[i+8]);
+            Y[2*i+1] = _mm_unpackhi_epi8(X[i], X[i+8]);
+        }
+
+        memcpy(X, Y, sizeof(Y));
+    }
+}
+
+static void _state_init(
+    slice         X[BLOCK_BYTES],
+    size_t        blocks_nb,
+    const uint8_t messages[blocks_nb*BLOCK_BYTES]
+)
+{
+    for (size_t b=0; b<PARALLEL_BLOCKS; b++)
+    {
+        X[b] = b < blocks_nb
+            ? _mm_loadu_si128((const slice *)&messages[b*BLOCK_BYTES])
+            : _mm_setzero_si128();
+    }
+
+    _transpose(X);
+}
+
+static void _state_extract(
+    slice   X[BLOCK_BYTES],
+    size_t  blocks_nb,
+    uint8_t output[blocks_nb*BLOCK_BYTES]
+)
+{
+    _transpose(X);
+
+    for (size_t b=0; b<blocks_nb; b++)
+    {
+        _mm_storeu_si128((slice *)&output[b*BLOCK_BYTES], X[b]);
+    }
+}
+
+
+static void _tweakey_state_init(
+    slice         TK[TWEAKEY_BYTES],
+    const uint8_t key[KEY_BYTES],
+    size_t        blocks_nb,
+    const uint8_t tweaks[blocks_nb][TWEAK_BYTES]
+)
+{
+    RAM_DATA_BYTE column[PARALLEL_BLOCKS];
+    memset(column, 0, sizeof(column));
+
+    for (size_t k=0; k<TWEAK_BYTES; k++)
+    {
+        for (size_t b=0; b<blocks_nb; b++)
+        {
+            column[b] = tweaks[b][k];
+        }
+        TK[k] = _mm_loadu_si128((const slice *)column);
+    }
+
+    for (size_t k=0; k<KEY_BYTES; k++)
+    {
+        TK[TWEAK_BYTES+k] = _mm_set1_epi8((char)key[k]);
+    }
+}
+
+static void _tweakey_state_extract(
+    const slice TK[TWEAKEY_BYTES],
+    uint8_t     round_constant,
+    slice       RTK[ROUND_TWEAKEY_BYTES]
+)
+{
+    for (size_t k=0; k<LANE_BYTES; k++)
+    {
+        RTK[k] = TK[k];
+
+        for (size_t j=1; j<LANES_NB; j++)
+        {
+            RTK[k] = XOR(RTK[k], TK[j*LANE_BYTES+k]);
+        }
+    }
+
+    RTK[0] = XOR(RTK[0], _mm_set1_epi8((char)round_constant));
+}
+
+
+/* Byte-sliced counterparts of multiplications.h. */
+
+static void _multiply_M(const slice x[LANE_BYTES], slice y[LANE_BYTES])
+{
+    y[7] = x[6];
+    y[6] = x[5];
+    y[5] = XOR(SHL(x[5], 3), x[4]);
+    y[4] = XOR(SHR(x[4], 3), x[3]);
+    y[3] = x[2];
+    y[2] = XOR(SHL(x[6], 2), x[1]);
+    y[1] = x[0];
+    y[0] = x[7];
+}
+
+static void _multiply_M2(const slice x[LANE_BYTES], slice y[LANE_BYTES])
+{
+    slice a5 = XOR(SHL(x[5], 3), x[4]);
+    slice a4 = XOR(SHR(x[4], 3), x[3]);
+
+    y[7] = x[5];
+    y[6] = a5;
+    y[5] = XOR(SHL(a5, 3),   a4);
+    y[4] = XOR(SHR(a4, 3),   x[2]);
+    y[3] = XOR(SHL(x[6], 2), x[1]);
+    y[2] = XOR(SHL(x[5], 2), x[0]);
+    y[1] = x[7];
+    y[0] = x[6];
+}
+
+static void _multiply_M3(const slice x[LANE_BYTES], slice y[LANE_BYTES])
+{
+    slice a5 = XOR(SHL(x[5], 3), x[4]);
+    slice a4 = XOR(SHR(x[4], 3), x[3]);
+    slice b5 = XOR(SHL(a5, 3),   a4);
+    slice b4 = XOR(SHR(a4, 3),   x[2]);
+
+    y[7] = a5;
+    y[6] = b5;
+    y[5] = XOR(SHL(b5, 3),   b4);
+    y[4] = XOR(XOR(SHR(b4, 3), SHL(x[6], 2)), x[1]);
+    y[3] = XOR(SHL(x[5], 2), x[0]);
+    y[2] = XOR(SHL(a5, 2),   x[7]);
+    y[1] = x[6];
+    y[0] = x[5];
+}
+
+static void _multiply_M4(const slice x[LANE_BYTES], slice y[LANE_BYTES])
+{
+    slice a5 = XOR(SHL(x[5], 3), x[4]);
+    slice a4 = XOR(SHR(x[4], 3), x[3]);
+    slice b5 = XOR(SHL(a5, 3),   a4);
+    slice b4 = XOR(SHR(a4, 3),   x[2]);
+    slice c4 = XOR(XOR(SHR(b4, 3), SHL(x[6], 2)), x[1]);
+    slice c5 = XOR(SHL(b5, 3),   b4);
+
+    y[7] = b5;
+    y[6] = c5;
+    y[5] = XOR(SHL(c5, 3), c4);
+    y[4] = XOR(XOR(SHR(c4, 3), SHL(x[5], 2)), x[0]);
+    y[3] = XOR(SHL(a5, 2), x[7]);
+    y[2] = XOR(SHL(b5, 2), x[6]);
+    y[1] = x[5];
+    y[0] = a5;
+}
+
+#if LANES_NB >= 5
+
+static void _multiply_MR(const slice x[LANE_BYTES], slice y[LANE_BYTES])
+{
+    y[0] = x[1];
+    y[1] = x[2];
+    y[2] = XOR(x[3],         SHR(x[4], 3));
+    y[3] = x[4];
+    y[4] = XOR(x[5],         SHL(x[6], 3));
+    y[5] = XOR(SHL(x[3], 2), x[6]);
+    y[6] = x[7];
+    y[7] = x[0];
+}
+
+#endif
+
+#if LANES_NB >= 6
+
+static void _multiply_MR2(const slice x[LANE_BYTES], slice y[LANE_BYTES])
+{
+    slice a4 = XOR(x[5], SHL(x[6], 3));
+
+    y[0] = x[2];
+    y[1] = XOR(x[3],         SHR(x[4], 3));
+    y[2] = XOR(x[4],         SHR(a4, 3));
+    y[3] = a4;
+    y[4] = XOR(XOR(SHL(x[3], 2), x[6]), SHL(x[7], 3));
+    y[5] = XOR(SHL(x[4], 2), x[7]);
+    y[6] = x[0];
+    y[7] = x[1];
+}
+
+#endif
+
+#if LANES_NB >= 7
+
+static void _multiply_MR3(const slice x[LANE_BYTES], slice y[LANE_BYTES])
+{
+    slice a4 = XOR(x[5], SHL(x[6], 3));
+    slice b4 = XOR(XOR(SHL(x[3], 2), x[6]), SHL(x[7], 3));
+
+    y[0] = XOR(x[3], SHR(x[4], 3));
+    y[1] = XOR(x[4], SHR(a4, 3));
+    y[2] = XOR(a4,   SHR(b4, 3));
+    y[3] = b4;
+    y[4] = XOR(XOR(SHL(x[0], 3), SHL(x[4], 2)), x[7]);
+    y[5] = XOR(SHL(a4, 2), x[0]);
+    y[6] = x[1];
+    y[7] = x[2];
+}
+
+#endif
+
+typedef void (*matrix_multiplication)(const slice x[LANE_BYTES], slice y[LANE_BYTES]);
+
+static inline void _multiply(slice TKj[LANE_BYTES], matrix_multiplication alpha)
+{
+    slice TKj_old[LANE_BYTES];
+    memcpy(TKj_old, TKj, sizeof(TKj_old));
+    alpha(TKj_old, TKj);
+}
+
+static void _tweakey_state_update(slice TK[TWEAKEY_BYTES])
+{
+    _multiply(TK + 0*LANE_BYTES, _multiply_M);
+    _multiply(TK + 1*LANE_BYTES, _multiply_M2);
+    _multiply(TK + 2*LANE_BYTES, _multiply_M3);
+    _multiply(TK + 3*LANE_BYTES, _multiply_M4);
+
+#if LANES_NB >= 5
+    _multiply(TK + 4*LANE_BYTES, _multiply_MR);
+
+#if LANES_NB >= 6
+    _multiply(TK + 5*LANE_BYTES, _multiply_MR2);
+
+#if LANES_NB >= 7
+    _multiply(TK + 6*LANE_BYTES, _multiply_MR3);
+#endif
+#endif
+#endif
+}
+
+
+static inline void _nonlinear_layer(slice X[BLOCK_BYTES], const slice RTK[ROUND_TWEAKEY_BYTES])
+{
+    for (size_t j=0; j<8; j++)
+    {
+        X[15-j] = XOR(X[15-j], sbox_ssse3(XOR(X[j], RTK[j])));
+    }
+}
+
+static inline void _linear_layer(slice X[BLOCK_BYTES])
+{
+    for (size_t j=1; j<8; j++)
+    {
+        X[15] = XOR(X[15], X[j]);
+    }
+
+    for (size_t j=14; j>8; j--)
+    {
+        X[j] = XOR(X[j], X[7]);
+    }
+}
+
+static inline void _permutation_layer(slice X[BLOCK_BYTES], const uint8_t pi[BLOCK_BYTES])
+{
+    slice X_old[BLOCK_BYTES];
+    memcpy(X_old, X, sizeof(X_old));
+
+    for (size_t j=0; j<BLOCK_BYTES; j++)
+    {
+        X[pi[j]] = X_old[j];
+    }
+}
+
+static inline void _one_round_egfn(
+    slice         X[BLOCK_BYTES],
+    const slice   RTK[ROUND_TWEAKEY_BYTES],
+    const uint8_t pi[BLOCK_BYTES] /* NULL for the last round */
+)
+{
+    _nonlinear_layer(X, RTK);
+    _linear_layer(X);
+
+    if (pi != NULL)
+    {
+        _permutation_layer(X, pi);
+    }
+}
+
+
+void lilliput_tbc_encrypt_blocks(
+    const uint8_t key[KEY_BYTES],
+    size_t        blocks_nb,
+    const uint8_t tweaks[blocks_nb][TWEAK_BYTES],
+    const uint8_t messages[blocks_nb*BLOCK_BYTES],
+    uint8_t       ciphertexts[blocks_nb*BLOCK_BYTES]
+)
+{
+    slice X[BLOCK_BYTES];
+    _state_init(X, blocks_nb, messages);
+
+    slice TK[TWEAKEY_BYTES];
+    slice RTK[ROUND_TWEAKEY_BYTES];
+    _tweakey_state_init(TK, key, blocks_nb, tweaks);
+
+    for (size_t i=0; i<ROUNDS-1; i++)
+    {
+        _tweakey_state_extract(TK, i, RTK);
+        _one_round_egfn(X, RTK, PI_ENCRYPTION);
+        _tweakey_state_update(TK);
+    }
+
+    _tweakey_state_extract(TK, ROUNDS-1, RTK);
+    _one_round_egfn(X, RTK, NULL);
+
+    _state_extract(X, blocks_nb, ciphertexts);
+}
+
+void lilliput_tbc_decrypt_blocks(
+    const uint8_t key[KEY_BYTES],
+    size_t        blocks_nb,
+    const uint8_t tweaks[blocks_nb][TWEAK_BYTES],
+    const uint8_t ciphertexts[blocks_nb*BLOCK_BYTES],
+    uint8_t       messages[blocks_nb*BLOCK_BYTES]
+)
+{
+    slice X[BLOCK_BYTES];
+    _state_init(X, blocks_nb, ciphertexts);
+
+    slice TK[TWEAKEY_BYTES];
+    slice RTK[ROUNDS][ROUND_TWEAKEY_BYTES];
+    _tweakey_state_init(TK, key, blocks_nb, tweaks);
+    _tweakey_state_extract(TK, 0, RTK[0]);
+
+    for (size_t i=1; i<ROUNDS; i++)
+    {
+        _tweakey_state_update(TK);
+        _tweakey_state_extract(TK, i, RTK[i]);
+    }
+
+    for (size_t i=0; i<ROUNDS-1; i++)
+    {
+        _one_round_egfn(X, RTK[ROUNDS-1-i], PI_DECRYPTION);
+    }
+
+    _one_round_egfn(X, RTK[0], NULL);
+
+    _state_extract(X, blocks_nb, messages);
+}
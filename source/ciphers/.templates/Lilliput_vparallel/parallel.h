@@ -0,0 +1,52 @@
+/*
+Implementation of the Lilliput-AE tweakable block cipher.
+
+Authors, hereby denoted as "the implementer":
+    Kévin Le Gouguec,
+    FELICS-AE contributors,
+    2026.
+
+For more information, feedback or questions, refer to our website:
+https://paclido.fr/lilliput-ae
+
+To the extent possible under law, the implementer has waived all copyright
+and related or neighboring rights to the source code in this file.
+http://creativecommons.org/publicdomain/zero/1.0/
+
+---
+
+This file provides the interface for the multi-block Lilliput-TBC engine,
+which processes up to PARALLEL_BLOCKS independent blocks, each with its own
+tweak, under a common key.
+*/
+
+#ifndef PARALLEL_H
+#define PARALLEL_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "constants.h"
+
+
+/* One byte of every block fits in a 128-bit register. */
+#define PARALLEL_BLOCKS 16
+
+
+void lilliput_tbc_encrypt_blocks(
+    const uint8_t key[KEY_BYTES],
+    size_t        blocks_nb, /* at most PARALLEL_BLOCKS */
+    const uint8_t tweaks[blocks_nb][TWEAK_BYTES],
+    const uint8_t messages[blocks_nb*BLOCK_BYTES],
+    uint8_t       ciphertexts[blocks_nb*BLOCK_BYTES]
+);
+
+void lilliput_tbc_decrypt_blocks(
+    const uint8_t key[KEY_BYTES],
+    size_t        blocks_nb, /* at most PARALLEL_BLOCKS */
+    const uint8_t tweaks[blocks_nb][TWEAK_BYTES],
+    const uint8_t ciphertexts[blocks_nb*BLOCK_BYTES],
+    uint8_t       messages[blocks_nb*BLOCK_BYTES]
+);
+
+#endif /* PARALLEL_H */
@@ -0,0 +1,65 @@
+/*
+Implementation of the Lilliput-AE tweakable block cipher.
+
+Authors, hereby denoted as "the implementer":
+    Kévin Le Gouguec,
+    FELICS-AE contributors,
+    2026.
+
+For more information, feedback or questions, refer to our website:
+https://paclido.fr/lilliput-ae
+
+To the extent possible under law, the implementer has waived all copyright
+and related or neighboring rights to the source code in this file.
+http://creativecommons.org/publicdomain/zero/1.0/
+
+---
+
+This file provides the S-box of Lilliput-TBC over the 16 bytes of an SSE
+register, using its decomposition as a 3-round Feistel network over nibbles:
+
+    hi ^= F1(lo);
+    lo ^= F2(hi);
+    hi ^= F3(lo);
+
+where each 4-bit function is evaluated with a single PSHUFB.  These lookups
+do not depend on memory accesses, and thus run in constant time.
+
+Including files must enable SSSE3, e.g. with #pragma GCC target("ssse3").
+*/
+
+#ifndef SBOX_SSSE3_H
+#define SBOX_SSSE3_H
+
+#include <tmmintrin.h>
+
+
+static inline __m128i sbox_ssse3(__m128i x)
+{
+    const __m128i F1 = _mm_setr_epi8(
+        0x00, 0x20, 0x00, 0xb0, 0x30, 0x00, 0x00, 0xa0,
+        0x10, 0xe0, 0x00, 0x60, 0xa0, 0x40, 0x50, 0x20
+    );
+    const __m128i F2 = _mm_setr_epi8(
+        0x00, 0x08, 0x01, 0x0f, 0x04, 0x0c, 0x07, 0x09,
+        0x02, 0x0b, 0x03, 0x06, 0x0e, 0x05, 0x0d, 0x0a
+    );
+    const __m128i F3 = _mm_setr_epi8(
+        0x20, 0x00, 0xb0, 0x00, 0x00, 0x30, 0xa0, 0x00,
+        0xe0, 0x10, 0x60, 0x00, 0x40, 0xa0, 0x20, 0x50
+    );
+    const __m128i low = _mm_set1_epi8(0x0f);
+
+    /* F1 and F3 are stored shifted into the upper nibble, so that the upper
+     * nibble never needs to be moved back and forth. */
+    __m128i lo = _mm_and_si128(x, low);
+    __m128i hi = _mm_andnot_si128(low, x);
+
+    hi = _mm_xor_si128(hi, _mm_shuffle_epi8(F1, lo));
+    lo = _mm_xor_si128(lo, _mm_shuffle_epi8(F2, _mm_and_si128(_mm_srli_epi16(hi, 4), low)));
+    hi = _mm_xor_si128(hi, _mm_shuffle_epi8(F3, lo));
+
+    return _mm_or_si128(hi, lo);
+}
+
+#endif /* SBOX_SSSE3_H */
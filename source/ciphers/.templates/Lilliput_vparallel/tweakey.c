@@ -0,0 +1 @@
+../Lilliput_vfelicsref/tweakey.c
\ No newline at end of file
@@ -0,0 +1 @@
+../Lilliput_vfelicsref/tweakey.h
\ No newline at end of file
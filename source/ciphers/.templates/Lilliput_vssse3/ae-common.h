@@ -0,0 +1 @@
+../Lilliput_vfelicsref/ae-common.h
\ No newline at end of file
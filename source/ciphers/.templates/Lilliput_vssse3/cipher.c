@@ -0,0 +1,163 @@
+/*
+Implementation of the Lilliput-AE tweakable block cipher.
+
+Authors, hereby denoted as "the implementer":
+    Kévin Le Gouguec,
+    FELICS-AE contributors,
+    2026.
+
+For more information, feedback or questions, refer to our website:
+https://paclido.fr/lilliput-ae
+
+To the extent possible under law, the implementer has waived all copyright
+and related or neighboring rights to the source code in this file.
+http://creativecommons.org/publicdomain/zero/1.0/
+
+---
+
+This file provides the implementation for Lilliput-TBC.
+
+The 16-byte state is held in a single SSE register:
+
+- the nonlinear layer evaluates the S-box of sbox-ssse3.h on all bytes at
+  once; a last PSHUFB then moves S(X[j]^RTK[j]) onto byte 15-j,
+
+- the linear layer folds bytes 1 to 7 into byte 0 with 64-bit shifts, and
+  broadcasts the result and X[7] with PSHUFB,
+
+- the permutation layer is a single PSHUFB.
+
+No lookup depends on secret data through memory accesses.
+*/
+
+#pragma GCC target("ssse3")
+
+#include <stdint.h>
+#include <string.h>
+
+#include <tmmintrin.h>
+
+#include "felics/cipher.h"
+
+#include "cipher.h"
+#include "constants.h"
+#include "sbox-ssse3.h"
+#include "tweakey.h"
+
+/* Only ΘCB3 mode needs decryption functions: define a symbol to
+ * selectively hide them. */
+#if TWEAK_LENGTH_BITS == 192
+#define LILLIPUT_I
+#endif
+
+
+#define XOR(a, b) _mm_xor_si128((a), (b))
+#define AND(a, b) _mm_and_si128((a), (b))
+
+/* PSHUFB gathers bytes, whereas PI scatters them: X[PI(j)] = X_old[j]
+ * translates to X[i] = X_old[PI^-1(i)]. */
+#define PERMUTATION_ENCRYPTION \
+    _mm_setr_epi8(14, 11, 12, 10,  8,  9, 13, 15,  3,  1,  4,  5,  6,  0,  2,  7)
+#define PERMUTATION_DECRYPTION \
+    _mm_setr_epi8(13,  9, 14,  8, 10, 11, 12, 15,  4,  5,  3,  1,  2,  6,  0,  7)
+
+
+static inline __m128i _nonlinear_layer(__m128i X, __m128i RTK)
+{
+    const __m128i mirror = _mm_setr_epi8(
+        -1, -1, -1, -1, -1, -1, -1, -1,
+         7,  6,  5,  4,  3,  2,  1,  0
+    );
+
+    return XOR(X, _mm_shuffle_epi8(sbox_ssse3(XOR(X, RTK)), mirror));
+}
+
+static inline __m128i _linear_layer(__m128i X)
+{
+    const __m128i bytes_1_7 = _mm_setr_epi8(
+         0, -1, -1, -1, -1, -1, -1, -1,
+         0,  0,  0,  0,  0,  0,  0,  0
+    );
+    const __m128i to_15 = _mm_setr_epi8(
+        -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1,  0
+    );
+    const __m128i from_7 = _mm_setr_epi8(
+        -1, -1, -1, -1, -1, -1, -1, -1,
+        -1,  7,  7,  7,  7,  7,  7, -1
+    );
+
+    __m128i sum = AND(X, bytes_1_7);
+    sum = XOR(sum, _mm_srli_epi64(sum, 32));
+    sum = XOR(sum, _mm_srli_epi64(sum, 16));
+    sum = XOR(sum, _mm_srli_epi64(sum,  8));
+
+    X = XOR(X, _mm_shuffle_epi8(sum, to_15));
+    return XOR(X, _mm_shuffle_epi8(X, from_7));
+}
+
+static inline __m128i _one_round_egfn(__m128i X, __m128i RTK)
+{
+    X = _nonlinear_layer(X, RTK);
+    return _linear_layer(X);
+}
+
+
+void lilliput_tbc_encrypt(
+    const uint8_t key[KEY_BYTES],
+    const uint8_t tweak[TWEAK_BYTES],
+    const uint8_t message[BLOCK_BYTES],
+    uint8_t ciphertext[BLOCK_BYTES]
+)
+{
+    __m128i X = _mm_loadu_si128((const __m128i *)message);
+
+    __m128i TK[TK_REGISTERS];
+    tweakey_state_init(TK, key, tweak);
+
+    for (size_t i=0; i<ROUNDS-1; i++)
+    {
+        X = _one_round_egfn(X, tweakey_state_extract(TK, i));
+        X = _mm_shuffle_epi8(X, PERMUTATION_ENCRYPTION);
+        tweakey_state_update(TK);
+    }
+
+    X = _one_round_egfn(X, tweakey_state_extract(TK, ROUNDS-1));
+
+    _mm_storeu_si128((__m128i *)ciphertext, X);
+}
+
+#ifdef LILLIPUT_I
+
+void lilliput_tbc_decrypt(
+    const uint8_t key[KEY_BYTES],
+    const uint8_t tweak[TWEAK_BYTES],
+    const uint8_t ciphertext[BLOCK_BYTES],
+    uint8_t message[BLOCK_BYTES]
+)
+{
+    __m128i X = _mm_loadu_si128((const __m128i *)ciphertext);
+
+    __m128i TK[TK_REGISTERS];
+    __m128i RTK[ROUNDS];
+    tweakey_state_init(TK, key, tweak);
+    RTK[0] = tweakey_state_extract(TK, 0);
+
+    for (size_t i=1; i<ROUNDS; i++)
+    {
+        tweakey_state_update(TK);
+        RTK[i] = tweakey_state_extract(TK, i);
+    }
+
+    for (size_t i=0; i<ROUNDS-1; i++)
+    {
+        X = _one_round_egfn(X, RTK[ROUNDS-1-i]);
+        X = _mm_shuffle_epi8(X, PERMUTATION_DECRYPTION);
+    }
+
+    X = _one_round_egfn(X, RTK[0]);
+
+    _mm_storeu_si128((__m128i *)message, X);
+}
+
+#endif
@@ -0,0 +1 @@
+../Lilliput_vfelicsref/cipher.h
\ No newline at end of file
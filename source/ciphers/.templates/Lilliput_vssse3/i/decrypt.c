@@ -0,0 +1 @@
+../../Lilliput_vfelicsref/i/decrypt.c
\ No newline at end of file
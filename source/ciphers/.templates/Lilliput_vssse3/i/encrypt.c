@@ -0,0 +1 @@
+../../Lilliput_vfelicsref/i/encrypt.c
\ No newline at end of file
@@ -0,0 +1 @@
+../../Lilliput_vfelicsref/i/lilliput-ae-i.h
\ No newline at end of file
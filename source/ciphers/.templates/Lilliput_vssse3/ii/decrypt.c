@@ -0,0 +1 @@
+../../Lilliput_vfelicsref/ii/decrypt.c
\ No newline at end of file
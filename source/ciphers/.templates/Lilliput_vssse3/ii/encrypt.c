@@ -0,0 +1 @@
+../../Lilliput_vfelicsref/ii/encrypt.c
\ No newline at end of file
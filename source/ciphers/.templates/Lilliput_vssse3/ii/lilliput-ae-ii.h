@@ -0,0 +1 @@
+../../Lilliput_vfelicsref/ii/lilliput-ae-ii.h
\ No newline at end of file
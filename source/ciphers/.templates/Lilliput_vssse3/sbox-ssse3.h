@@ -0,0 +1 @@
+../Lilliput_vparallel/sbox-ssse3.h
\ No newline at end of file
@@ -0,0 +1,137 @@
+/*
+Implementation of the Lilliput-AE tweakable block cipher.
+
+Authors, hereby denoted as "the implementer":
+    Kévin Le Gouguec,
+    FELICS-AE contributors,
+    2026.
+
+For more information, feedback or questions, refer to our website:
+https://paclido.fr/lilliput-ae
+
+To the extent possible under law, the implementer has waived all copyright
+and related or neighboring rights to the source code in this file.
+http://creativecommons.org/publicdomain/zero/1.0/
+
+---
+
+This file provides the implementation of Lilliput-TBC's tweakey schedule.
+
+Each lane is handled as a little-endian 64-bit word, so that the byte moves
+of the multiplications in multiplications.h become a byte rotation (a single
+PSHUFB for both lanes of a register), and their bit shifts become three
+masked 64-bit shifts.
+*/
+
+#pragma GCC target("ssse3")
+
+#include <stdint.h>
+#include <string.h>
+
+#include <tmmintrin.h>
+
+#include "felics/cipher.h"
+
+#include "constants.h"
+#include "tweakey.h"
+
+
+#define XOR(a, b) _mm_xor_si128((a), (b))
+#define AND(a, b) _mm_and_si128((a), (b))
+
+
+void tweakey_state_init(
+    __m128i TK[TK_REGISTERS],
+    const uint8_t key[KEY_BYTES],
+    const uint8_t tweak[TWEAK_BYTES]
+)
+{
+    RAM_DATA_BYTE buffer[TK_REGISTERS*16];
+    memset(buffer, 0, sizeof(buffer));
+    memcpy(buffer,             tweak, TWEAK_BYTES);
+    memcpy(buffer+TWEAK_BYTES, key,   KEY_BYTES);
+
+    for (size_t r=0; r<TK_REGISTERS; r++)
+    {
+        TK[r] = _mm_loadu_si128((const __m128i *)&buffer[16*r]);
+    }
+}
+
+
+__m128i tweakey_state_extract(
+    const __m128i TK[TK_REGISTERS],
+    uint8_t round_constant
+)
+{
+    __m128i rtk = TK[0];
+
+    for (size_t r=1; r<TK_REGISTERS; r++)
+    {
+        rtk = XOR(rtk, TK[r]);
+    }
+
+    rtk = XOR(rtk, _mm_unpackhi_epi64(rtk, rtk));
+
+    return XOR(rtk, _mm_cvtsi32_si128(round_constant));
+}
+
+
+/* y[7..0] = x[6], x[5], x[5]<<3 ^ x[4], x[4]>>3 ^ x[3],
+ *           x[2], x[6]<<2 ^ x[1], x[0], x[7] */
+static inline __m128i _multiply_M(__m128i x)
+{
+    const __m128i rotl8 = _mm_setr_epi8(
+        7, 0, 1, 2,  3,  4,  5,  6,
+        15, 8, 9, 10, 11, 12, 13, 14
+    );
+
+    __m128i y = _mm_shuffle_epi8(x, rotl8);
+    y = XOR(y, AND(_mm_slli_epi64(x,  3), _mm_set1_epi64x(0x0000f80000000000)));
+    y = XOR(y, AND(_mm_srli_epi64(x,  3), _mm_set1_epi64x(0x0000001f00000000)));
+    y = XOR(y, AND(_mm_srli_epi64(x, 30), _mm_set1_epi64x(0x0000000000fc0000)));
+    return y;
+}
+
+/* y[7..0] = x[0], x[7], x[3]<<2 ^ x[6], x[6]<<3 ^ x[5],
+ *           x[4], x[4]>>3 ^ x[3], x[2], x[1] */
+static inline __m128i _multiply_MR(__m128i x)
+{
+    const __m128i rotr8 = _mm_setr_epi8(
+        1, 2,  3,  4,  5,  6,  7, 0,
+        9, 10, 11, 12, 13, 14, 15, 8
+    );
+
+    __m128i y = _mm_shuffle_epi8(x, rotr8);
+    y = XOR(y, AND(_mm_srli_epi64(x, 19), _mm_set1_epi64x(0x00000000001f0000)));
+    y = XOR(y, AND(_mm_srli_epi64(x, 13), _mm_set1_epi64x(0x000000f800000000)));
+    y = XOR(y, AND(_mm_slli_epi64(x, 18), _mm_set1_epi64x(0x0000fc0000000000)));
+    return y;
+}
+
+/* Lower lane from lo, upper lane from hi. */
+static inline __m128i _merge_lanes(__m128i lo, __m128i hi)
+{
+    return _mm_castpd_si128(_mm_move_sd(_mm_castsi128_pd(hi), _mm_castsi128_pd(lo)));
+}
+
+void tweakey_state_update(__m128i TK[TK_REGISTERS])
+{
+    /* Lanes 0 and 1: M, M^2. */
+    TK[0] = _multiply_M(TK[0]);
+    TK[0] = _merge_lanes(TK[0], _multiply_M(TK[0]));
+
+    /* Lanes 2 and 3: M^3, M^4. */
+    TK[1] = _multiply_M(_multiply_M(_multiply_M(TK[1])));
+    TK[1] = _merge_lanes(TK[1], _multiply_M(TK[1]));
+
+#if LANES_NB >= 5
+    /* Lanes 4 and 5: MR, MR^2. */
+    TK[2] = _multiply_MR(TK[2]);
+    TK[2] = _merge_lanes(TK[2], _multiply_MR(TK[2]));
+
+#if LANES_NB >= 7
+    /* Lane 6: MR^3. */
+    TK[3] = _multiply_MR(_multiply_MR(_multiply_MR(TK[3])));
+#endif
+#endif
+}
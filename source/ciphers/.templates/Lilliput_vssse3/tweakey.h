@@ -0,0 +1,51 @@
+/*
+Implementation of the Lilliput-AE tweakable block cipher.
+
+Authors, hereby denoted as "the implementer":
+    Kévin Le Gouguec,
+    FELICS-AE contributors,
+    2026.
+
+For more information, feedback or questions, refer to our website:
+https://paclido.fr/lilliput-ae
+
+To the extent possible under law, the implementer has waived all copyright
+and related or neighboring rights to the source code in this file.
+http://creativecommons.org/publicdomain/zero/1.0/
+
+---
+
+This file provides the interface for Lilliput-TBC's tweakey schedule.
+
+The tweakey state is held in SSE registers, two lanes per register; the
+upper half of the last register is unused when the number of lanes is odd.
+*/
+
+#ifndef TWEAKEY_H
+#define TWEAKEY_H
+
+#include <stdint.h>
+
+#include <emmintrin.h>
+
+#include "constants.h"
+
+
+#define TK_REGISTERS ((LANES_NB+1)/2)
+
+
+void tweakey_state_init(
+    __m128i TK[TK_REGISTERS],
+    const uint8_t key[KEY_BYTES],
+    const uint8_t tweak[TWEAK_BYTES]
+);
+
+/* The round tweakey is returned in the lower 8 bytes. */
+__m128i tweakey_state_extract(
+    const __m128i TK[TK_REGISTERS],
+    uint8_t round_constant
+);
+
+void tweakey_state_update(__m128i TK[TK_REGISTERS]);
+
+#endif /* TWEAKEY_H */
@@ -0,0 +1,215 @@
+/*
+Implementation of the Lilliput-AE tweakable block cipher.
+
+Authors, hereby denoted as "the implementer":
+    Kévin Le Gouguec,
+    FELICS-AE contributors,
+    2026.
+
+For more information, feedback or questions, refer to our website:
+https://paclido.fr/lilliput-ae
+
+To the extent possible under law, the implementer has waived all copyright
+and related or neighboring rights to the source code in this file.
+http://creativecommons.org/publicdomain/zero/1.0/
+
+---
+
+This file provides the random byte generation backends.
+
+The ChaCha backend runs ChaCha with 8 rounds (CHACHA_ROUNDS) in counter mode
+with an all-zero nonce.  Bytes handed out are wiped from the buffer, so that
+the masks already used cannot be recovered from memory.
+*/
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "felics/cipher.h"
+
+#include "random.h"
+
+
+uint32_t RandomBytesCount = 0;
+
+
+#if RANDOM_BACKEND == RANDOM_BACKEND_STUB
+
+void random_seed(const uint8_t seed[RANDOM_SEED_BYTES])
+{
+    (void)seed;
+}
+
+void randombytes(size_t n, uint8_t output[n])
+{
+    memset(output, 0x2a, n);
+    RandomBytesCount += n;
+}
+
+#else /* RANDOM_BACKEND_CHACHA, RANDOM_BACKEND_EXTERNAL */
+
+#define CHACHA_BLOCK_BYTES  64
+#define RANDOM_BUFFER_BYTES (RANDOM_BUFFER_BLOCKS*CHACHA_BLOCK_BYTES)
+
+static RAM_DATA_BYTE buffer[RANDOM_BUFFER_BYTES];
+static size_t position = RANDOM_BUFFER_BYTES;
+
+
+#if RANDOM_BACKEND == RANDOM_BACKEND_CHACHA
+
+#ifndef CHACHA_ROUNDS
+#define CHACHA_ROUNDS 8
+#endif
+
+#define ROTL32(x, n) (((x) << (n)) | ((x) >> (32-(n))))
+
+#define QUARTER_ROUND(a, b, c, d)                   \
+    do {                                            \
+        a += b; d ^= a; d = ROTL32(d, 16);          \
+        c += d; b ^= c; b = ROTL32(b, 12);          \
+        a += b; d ^= a; d = ROTL32(d,  8);          \
+        c += d; b ^= c; b = ROTL32(b,  7);          \
+    } while (0)
+
+static uint32_t chacha_key[8];
+static uint32_t chacha_counter[2];
+
+
+static uint32_t _load32(const uint8_t bytes[4])
+{
+    return (uint32_t)bytes[0]
+        | (uint32_t)bytes[1] << 8
+        | (uint32_t)bytes[2] << 16
+        | (uint32_t)bytes[3] << 24;
+}
+
+static void _store32(uint8_t bytes[4], uint32_t w)
+{
+    bytes[0] = w;
+    bytes[1] = w >> 8;
+    bytes[2] = w >> 16;
+    bytes[3] = w >> 24;
+}
+
+static void _chacha_block(uint8_t output[CHACHA_BLOCK_BYTES])
+{
+    uint32_t input[16] = {
+        /* "expand 32-byte k" */
+        0x61707865, 0x3320646e, 0x79622d32, 0x6b206574,
+        chacha_key[0], chacha_key[1], chacha_key[2], chacha_key[3],
+        chacha_key[4], chacha_key[5], chacha_key[6], chacha_key[7],
+        chacha_counter[0], chacha_counter[1], 0, 0
+    };
+    uint32_t x[16];
+    memcpy(x, input, sizeof(x));
+
+    for (size_t i=0; i<CHACHA_ROUNDS; i+=2)
+    {
+        QUARTER_ROUND(x[0], x[4], x[ 8], x[12]);
+        QUARTER_ROUND(x[1], x[5], x[ 9], x[13]);
+        QUARTER_ROUND(x[2], x[6], x[10], x[14]);
+        QUARTER_ROUND(x[3], x[7], x[11], x[15]);
+
+        QUARTER_ROUND(x[0], x[5], x[10], x[15]);
+        QUARTER_ROUND(x[1], x[6], x[11], x[12]);
+        QUARTER_ROUND(x[2], x[7], x[ 8], x[13]);
+        QUARTER_ROUND(x[3], x[4], x[ 9], x[14]);
+    }
+
+    for (size_t i=0; i<16; i++)
+    {
+        _store32(output + 4*i, x[i] + input[i]);
+    }
+
+    if (++chacha_counter[0] == 0)
+    {
+        chacha_counter[1]++;
+    }
+}
+
+void random_seed(const uint8_t seed[RANDOM_SEED_BYTES])
+{
+    for (size_t i=0; i<8; i++)
+    {
+        chacha_key[i] = _load32(seed + 4*i);
+    }
+
+    chacha_counter[0] = 0;
+    chacha_counter[1] = 0;
+
+    memset(buffer, 0, sizeof(buffer));
+    position = RANDOM_BUFFER_BYTES;
+}
+
+#ifdef PC
+
+#include <stdio.h>
+
+/* Seed from the operating system before main() runs, so that the masks are
+ * not predictable and the seeding is not part of the measurements. */
+__attribute__((constructor)) static void _seed_from_os(void)
+{
+    uint8_t seed[RANDOM_SEED_BYTES];
+    FILE *source = fopen("/dev/urandom", "rb");
+
+    if (source == NULL || fread(seed, 1, sizeof(seed), source) != sizeof(seed))
+    {
+        abort();
+    }
+
+    fclose(source);
+    random_seed(seed);
+    memset(seed, 0, sizeof(seed));
+}
+
+#endif
+
+static void _refill(void)
+{
+    for (size_t b=0; b<RANDOM_BUFFER_BLOCKS; b++)
+    {
+        _chacha_block(buffer + b*CHACHA_BLOCK_BYTES);
+    }
+}
+
+#else /* RANDOM_BACKEND_EXTERNAL */
+
+void random_seed(const uint8_t seed[RANDOM_SEED_BYTES])
+{
+    (void)seed;
+}
+
+static void _refill(void)
+{
+    random_source(RANDOM_BUFFER_BYTES, buffer);
+}
+
+#endif
+
+
+void randombytes(size_t n, uint8_t output[n])
+{
+    RandomBytesCount += n;
+
+    while (n > 0)
+    {
+        if (position == RANDOM_BUFFER_BYTES)
+        {
+            _refill();
+            position = 0;
+        }
+
+        size_t available = RANDOM_BUFFER_BYTES - position;
+        size_t chunk = n < available ? n : available;
+
+        memcpy(output, buffer+position, chunk);
+        memset(buffer+position, 0, chunk);
+
+        position += chunk;
+        output += chunk;
+        n -= chunk;
+    }
+}
+
+#endif
@@ -3,7 +3,8 @@ Implementation of the Lilliput-AE tweakable block cipher.
 
 Authors, hereby denoted as "the implementer":
     Kévin Le Gouguec,
-    2019.
+    FELICS-AE contributors,
+    2019, 2026.
 
 For more information, feedback or questions, refer to our website:
 https://paclido.fr/lilliput-ae
@@ -14,20 +15,62 @@ http://creativecommons.org/publicdomain/zero/1.0/
 
 ---
 
-This file provides a stub for random byte generation.
+This file provides the interface for random byte generation.
+
+The backend is selected at compile time by defining RANDOM_BACKEND (e.g.
+with COMPILER_OPTIONS=-DRANDOM_BACKEND=RANDOM_BACKEND_STUB):
+
+- RANDOM_BACKEND_CHACHA (default): a buffered ChaCha keystream generator,
+  keyed with random_seed() (see below for where the seed comes from); the
+  buffer is refilled RANDOM_BUFFER_BLOCKS ChaCha blocks at a time,
+
+- RANDOM_BACKEND_EXTERNAL: the same buffering, refilled by random_source(),
+  which the platform provides (e.g. a TRNG driver),
+
+- RANDOM_BACKEND_STUB: the historical stub, which fills buffers with 0x2a
+  and thus leaves the cost of randomness out of measurements.
+
+Every backend adds the number of bytes it hands out to RandomBytesCount,
+which FELICS reports with the cycle counts and in debug builds.
 */
 
 #ifndef RANDOM_H
 #define RANDOM_H
 
+#include <stddef.h>
 #include <stdint.h>
-#include <string.h>
 
 
-static void randombytes(size_t n, uint8_t output[n])
-{
-    memset(output, 0x2a, n);
-}
+#define RANDOM_BACKEND_STUB     0
+#define RANDOM_BACKEND_CHACHA   1
+#define RANDOM_BACKEND_EXTERNAL 2
+
+#ifndef RANDOM_BACKEND
+#define RANDOM_BACKEND RANDOM_BACKEND_CHACHA
+#endif
+
+#ifndef RANDOM_BUFFER_BLOCKS
+#define RANDOM_BUFFER_BLOCKS 2
+#endif
+
+#define RANDOM_SEED_BYTES 32
+
+
+void randombytes(size_t n, uint8_t output[n]);
+
+/* Keys the ChaCha backend.  The seed must be secret and come from a true
+ * random source (e.g. a TRNG, or the operating system's generator), since
+ * anyone who knows it can predict every mask.
+ *
+ * On PC, the ChaCha backend seeds itself from /dev/urandom at startup, before
+ * main() runs.  On the other platforms, the application must call this before
+ * the first encryption: until then, the generator runs with an all-zero key,
+ * i.e. with public masks, which is only acceptable for benchmarks. */
+void random_seed(const uint8_t seed[RANDOM_SEED_BYTES]);
+
+#if RANDOM_BACKEND == RANDOM_BACKEND_EXTERNAL
+void random_source(size_t n, uint8_t output[n]);
+#endif
 
 
 #endif /* RANDOM_H */
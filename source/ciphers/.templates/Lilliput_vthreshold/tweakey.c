@@ -31,11 +31,6 @@ tweakey schedule, where the tweak and the key are split into two shares.
 #include "tweakey.h"
 
 
-#define LANES_NB       (TWEAKEY_BYTES/LANE_BYTES)
-#define TWEAK_LANES_NB (TWEAK_BYTES/LANE_BYTES)
-#define KEY_LANES_NB   (KEY_BYTES/LANE_BYTES)
-
-
 void tweakey_state_init(
     uint8_t TK_X[TWEAKEY_BYTES],
     uint8_t TK_Y[KEY_BYTES],
@@ -0,0 +1,210 @@
+/*
+TweGIFT-64 bitsliced implementation, see twegift64.h.
+
+Derived from twegift-64.c of the LOCUS-AEAD and LOTUS-AEAD reference
+implementations, by the LOCUS/LOTUS implementers.
+
+Modified in 2026 by FELICS-AE contributors: bitsliced state, round keys
+computed once per key, expanded tweaks in a table.
+*/
+
+#include <stdint.h>
+
+#include "twegift64.h"
+
+/* Add the round tweak every TWEAKING_PERIOD rounds, but not after the last one */
+#define TWEAKING_PERIOD     4
+
+#define ROL16(x, n)         ((((x) << (n)) | ((x) >> (16 - (n)))) & 0xffff)
+
+/* Swaps the bits of x selected by mask with the bits n positions above */
+#define SWAPMOVE(x, mask, n) do {                   \
+    uint64_t tmp_ = ((x) ^ ((x) >> (n))) & (mask);  \
+    (x) ^= tmp_ ^ (tmp_ << (n));                    \
+} while (0)
+
+#define SWAPMOVE16(x, mask, n) do {                 \
+    uint32_t tmp_ = ((x) ^ ((x) >> (n))) & (mask);  \
+    (x) ^= tmp_ ^ (tmp_ << (n));                    \
+} while (0)
+
+#define SBOX(s0, s1, s2, s3) do {                   \
+    uint32_t tmp_;                                  \
+    s1 ^= s0 & s2;                                  \
+    s0 ^= s1 & s3;                                  \
+    s2 ^= s0 | s1;                                  \
+    s3 ^= s2;                                       \
+    s1 ^= s3;                                       \
+    s3 ^= 0xffff;                                   \
+    s2 ^= s0 & s1;                                  \
+    tmp_ = s0; s0 = s3; s3 = tmp_;                  \
+} while (0)
+
+#define SBOX_INV(s0, s1, s2, s3) do {               \
+    uint32_t tmp_;                                  \
+    tmp_ = s0; s0 = s3; s3 = tmp_;                  \
+    s2 ^= s0 & s1;                                  \
+    s3 ^= 0xffff;                                   \
+    s1 ^= s3;                                       \
+    s3 ^= s2;                                       \
+    s2 ^= s0 | s1;                                  \
+    s0 ^= s1 & s3;                                  \
+    s1 ^= s0 & s2;                                  \
+} while (0)
+
+/* Transpose the 4x4 bit matrix of nibbles x (bit 4a+b to bit 4b+a) */
+#define TRANSPOSE(x) do {                           \
+    SWAPMOVE16(x, 0x0a0a, 3);                       \
+    SWAPMOVE16(x, 0x00cc, 6);                       \
+} while (0)
+
+/*
+In plane j, PermBits moves nibble 4a+b to nibble 4((j-b) mod 4)+a: a
+transpose, then nibble r to nibble (j-r) mod 4.  Both steps are
+involutions, so the inverse applies them in the other order.
+*/
+#define NIBBLE_MAP_0(x)     (((x) & 0x0f0f) | (((x) >> 8) & 0x00f0) | (((x) << 8) & 0xf000))
+#define NIBBLE_MAP_1(x)     ((((x) >> 4) & 0x0f0f) | (((x) << 4) & 0xf0f0))
+#define NIBBLE_MAP_2(x)     (((x) & 0xf0f0) | (((x) >> 8) & 0x000f) | (((x) << 8) & 0x0f00))
+#define NIBBLE_MAP_3(x)     NIBBLE_MAP_1(((x) >> 8) | (((x) << 8) & 0xff00))
+
+#define PERM(s0, s1, s2, s3) do {                   \
+    TRANSPOSE(s0); s0 = NIBBLE_MAP_0(s0);           \
+    TRANSPOSE(s1); s1 = NIBBLE_MAP_1(s1);           \
+    TRANSPOSE(s2); s2 = NIBBLE_MAP_2(s2);           \
+    TRANSPOSE(s3); s3 = NIBBLE_MAP_3(s3);           \
+} while (0)
+
+#define PERM_INV(s0, s1, s2, s3) do {               \
+    s0 = NIBBLE_MAP_0(s0); TRANSPOSE(s0);           \
+    s1 = NIBBLE_MAP_1(s1); TRANSPOSE(s1);           \
+    s2 = NIBBLE_MAP_2(s2); TRANSPOSE(s2);           \
+    s3 = NIBBLE_MAP_3(s3); TRANSPOSE(s3);           \
+} while (0)
+
+static const uint8_t round_constants[TWEGIFT64_ROUNDS] = {
+    0x01, 0x03, 0x07, 0x0F, 0x1F, 0x3E, 0x3D, 0x3B, 0x37, 0x2F,
+    0x1E, 0x3C, 0x39, 0x33, 0x27, 0x0E, 0x1D, 0x3A, 0x35, 0x2B,
+    0x16, 0x2C, 0x18, 0x30, 0x21, 0x02, 0x05, 0x0B
+};
+
+/*
+expand_tweak() of the reference for every 4-bit tweak t, as plane 2 mask:
+the nibbles t, t', t, t' where t' is t with its bits flipped if t has odd
+parity.
+*/
+static const uint16_t expanded_tweaks[16] = {
+    0x0000, 0xe1e1, 0xd2d2, 0x3333, 0xb4b4, 0x5555, 0x6666, 0x8787,
+    0x7878, 0x9999, 0xaaaa, 0x4b4b, 0xcccc, 0x2d2d, 0x1e1e, 0xffff
+};
+
+static inline uint64_t load64(const uint8_t *p)
+{
+    uint64_t x = 0;
+    int i;
+
+    for (i = 7; i >= 0; i--) x = (x << 8) | p[i];
+    return x;
+}
+
+static inline void store64(uint8_t *p, uint64_t x)
+{
+    int i;
+
+    for (i = 0; i < 8; i++, x >>= 8) p[i] = (uint8_t)x;
+}
+
+/* nibble i of x (bits 4i to 4i+3) to bit i of plane j, for all j */
+static inline void to_planes(uint16_t s[4], uint64_t x)
+{
+    SWAPMOVE(x, 0x0a0a0a0a0a0a0a0aULL, 3);
+    SWAPMOVE(x, 0x00cc00cc00cc00ccULL, 6);
+    SWAPMOVE(x, 0x0000f0f00000f0f0ULL, 12);
+    SWAPMOVE(x, 0x00000000ff00ff00ULL, 24);
+    s[0] = (uint16_t)x;
+    s[1] = (uint16_t)(x >> 16);
+    s[2] = (uint16_t)(x >> 32);
+    s[3] = (uint16_t)(x >> 48);
+}
+
+static inline uint64_t from_planes(const uint16_t s[4])
+{
+    uint64_t x = (uint64_t)s[0] | (uint64_t)s[1] << 16 | (uint64_t)s[2] << 32 | (uint64_t)s[3] << 48;
+
+    SWAPMOVE(x, 0x00000000ff00ff00ULL, 24);
+    SWAPMOVE(x, 0x0000f0f00000f0f0ULL, 12);
+    SWAPMOVE(x, 0x00cc00cc00cc00ccULL, 6);
+    SWAPMOVE(x, 0x0a0a0a0a0a0a0a0aULL, 3);
+    return x;
+}
+
+void twegift64_keyschedule(uint32_t rkey[TWEGIFT64_RKEY_WORDS], const uint8_t key[16])
+{
+    /* k[m] holds nibbles 4m to 4m+3 of the key state */
+    uint16_t k[8], k0, k1;
+    int i, r;
+
+    for (i = 0; i < 8; i++) k[i] = (uint16_t)(key[2*i] | key[2*i+1] << 8);
+
+    for (r = 0; r < TWEGIFT64_ROUNDS; r++)
+    {
+        rkey[r] = (uint32_t)k[0] | (uint32_t)k[1] << 16;
+
+        /* key state >>> 32 nibbles-wise, then k0 >>> 12 and k1 >>> 2 */
+        k0 = k[0];
+        k1 = k[1];
+        for (i = 0; i < 6; i++) k[i] = k[i+2];
+        k[6] = ROL16(k0, 4);
+        k[7] = ROL16(k1, 14);
+    }
+}
+
+void twegift64_encrypt_block(uint8_t ctext[8], const uint32_t rkey[TWEGIFT64_RKEY_WORDS], uint8_t twk, const uint8_t ptext[8])
+{
+    uint16_t s[4];
+    uint32_t s0, s1, s2, s3;
+    uint32_t t = expanded_tweaks[twk & 0xf];
+    int r;
+
+    to_planes(s, load64(ptext));
+    s0 = s[0]; s1 = s[1]; s2 = s[2]; s3 = s[3];
+
+    for (r = 0; r < TWEGIFT64_ROUNDS; r++)
+    {
+        SBOX(s0, s1, s2, s3);
+        PERM(s0, s1, s2, s3);
+
+        s0 ^= rkey[r] & 0xffff;
+        s1 ^= rkey[r] >> 16;
+        if (r != TWEGIFT64_ROUNDS-1 && (r+1) % TWEAKING_PERIOD == 0) s2 ^= t;
+        s3 ^= 0x8000 ^ round_constants[r];
+    }
+
+    s[0] = (uint16_t)s0; s[1] = (uint16_t)s1; s[2] = (uint16_t)s2; s[3] = (uint16_t)s3;
+    store64(ctext, from_planes(s));
+}
+
+void twegift64_decrypt_block(uint8_t ptext[8], const uint32_t rkey[TWEGIFT64_RKEY_WORDS], uint8_t twk, const uint8_t ctext[8])
+{
+    uint16_t s[4];
+    uint32_t s0, s1, s2, s3;
+    uint32_t t = expanded_tweaks[twk & 0xf];
+    int r;
+
+    to_planes(s, load64(ctext));
+    s0 = s[0]; s1 = s[1]; s2 = s[2]; s3 = s[3];
+
+    for (r = TWEGIFT64_ROUNDS-1; r >= 0; r--)
+    {
+        s0 ^= rkey[r] & 0xffff;
+        s1 ^= rkey[r] >> 16;
+        if (r != TWEGIFT64_ROUNDS-1 && (r+1) % TWEAKING_PERIOD == 0) s2 ^= t;
+        s3 ^= 0x8000 ^ round_constants[r];
+
+        PERM_INV(s0, s1, s2, s3);
+        SBOX_INV(s0, s1, s2, s3);
+    }
+
+    s[0] = (uint16_t)s0; s[1] = (uint16_t)s1; s[2] = (uint16_t)s2; s[3] = (uint16_t)s3;
+    store64(ptext, from_planes(s));
+}
@@ -0,0 +1,31 @@
+/*
+TweGIFT-64 bitsliced implementation, shared by the vbitsliced
+implementations of LOCUS-AEAD and LOTUS-AEAD.
+
+The 64-bit state is held as four 16-bit bit planes: bit i of plane j is bit
+j of nibble i.  SubCells is then a handful of logical operations on the
+planes, and PermBits, which never moves a bit to another plane, is a 4x4
+bit transpose and a nibble reordering within each plane.  Round keys are
+computed once per key, so that several blocks (or the decryption) can
+reuse them; the 4-bit tweaks are expanded through a 16-entry table.
+*/
+
+#ifndef TWEGIFT64_H
+#define TWEGIFT64_H
+
+#include <stdint.h>
+
+#define TWEGIFT64_ROUNDS        28
+
+/* One round key word per round: U in bits 0-15, V in bits 16-31 */
+#define TWEGIFT64_RKEY_WORDS    TWEGIFT64_ROUNDS
+
+/*
+Bytes are loaded as in the LOCUS/LOTUS reference: nibble 2i (resp. 2i+1) of
+the state and of the key is the low (resp. high) nibble of byte i.
+*/
+void twegift64_keyschedule(uint32_t rkey[TWEGIFT64_RKEY_WORDS], const uint8_t key[16]);
+void twegift64_encrypt_block(uint8_t ctext[8], const uint32_t rkey[TWEGIFT64_RKEY_WORDS], uint8_t twk, const uint8_t ptext[8]);
+void twegift64_decrypt_block(uint8_t ptext[8], const uint32_t rkey[TWEGIFT64_RKEY_WORDS], uint8_t twk, const uint8_t ctext[8]);
+
+#endif /* TWEGIFT64_H */
@@ -17,7 +17,6 @@ do
 done
 
 templates_dir=$(dirname $(realpath $0))
-ciphers_dir=${templates_dir}/..
 
 mkdir -p ${templates_dir}/Lilliput_v${new}/{i,ii}
 
@@ -34,27 +33,7 @@ mkdir -p ${templates_dir}/Lilliput_v${new}/{i,ii}
     done
 )
 
-mkdir -p ${ciphers_dir}/Lilliput-{I,II}-{128,192,256}_v${new}/source
-
-for mode in i ii
-do
-    for keylen in 128 192 256
-    do
-        variant=Lilliput-${mode^^}-${keylen}
-        new_dir=${variant}_v${new}
-        ref_dir=${variant}_v${ref}
-
-        (
-            cd ${ciphers_dir}/${new_dir}/source
-            # Implementation-indepdendent files.
-            ln -s ../../.templates/Lilliput_vfelicsref/api.h .
-            ln -s ../../${variant}_vfelicsref/source/{test_vectors.c,parameters.h} .
-            # Other files.
-            ln -s ../../.templates/Lilliput_v${new}/!(api).[chS] .
-            ln -s ../../.templates/Lilliput_v${new}/${mode}/* .
-        )
-    done
-done
+${templates_dir}/generate-lilliput-variants.sh ${new}
 
 ref_dir=$(realpath --relative-to=. ${templates_dir}/Lilliput_v${ref})
 new_dir=$(realpath --relative-to=. ${templates_dir}/Lilliput_v${new})
@@ -70,6 +49,9 @@ You may now:
 
 - copy files from ${ref_dir}
   over symlinks in ${new_dir}
-  and start editing these copies.
+  and start editing these copies,
+
+- run $(realpath --relative-to=. ${templates_dir})/generate-lilliput-variants.sh ${new}
+  whenever files are added to or removed from the template.
 
 EOF
@@ -0,0 +1,241 @@
+#!/bin/bash
+# SPDX-License-Identifier: GPL-3.0-or-later
+# SPDX-FileCopyrightText: 2026 FELICS-AE contributors
+
+set -eu
+shopt -s extglob nullglob
+
+usage ()
+{
+    cat <<EOF
+Usage: $0 [--modes="i ii"] [--keys="128 192 256"] [--authors=AUTHORS]
+        [--run[=OPTIONS]] VERSION...
+
+(Re)generate Lilliput-{I,II}-{128,192,256}_vVERSION from the template in
+.templates/Lilliput_vVERSION.
+
+Each variant directory gets symlinks to:
+- the implementation-independent files (api.h, parameters.h and
+  test_vectors.c) of the matching _vfelicsref variant,
+- the files of the template, then those of its i/ or ii/ subfolder.
+
+Symlinks already present in a variant directory are replaced; regular files
+are left alone, so that a variant may still override a template file.
+
+Modes default to the subfolders the template provides.  When a mode
+subfolder has no implementation.info, one is generated; its authors are
+AUTHORS if given, otherwise those of the template's other mode, or else of
+the _vfelicsref template, followed by FELICS-AE contributors.
+
+With --run, the generated variants are passed to scripts/felics-run; OPTIONS
+is appended to its command line.
+EOF
+}
+
+modes=
+keys="128 192 256"
+run=false
+run_options=
+authors=
+versions=()
+
+for arg
+do
+    case ${arg} in
+        --modes=*)
+            modes=${arg#*=}
+            ;;
+        --keys=*)
+            keys=${arg#*=}
+            ;;
+        --authors=*)
+            authors=${arg#*=}
+            ;;
+        --run)
+            run=true
+            ;;
+        --run=*)
+            run=true
+            run_options=${arg#*=}
+            ;;
+        -h|--help)
+            usage
+            exit 0
+            ;;
+        *)
+            versions+=(${arg})
+    esac
+done
+
+if ((${#versions[@]} == 0))
+then
+    usage
+    exit 1
+fi
+
+templates_dir=$(dirname $(realpath $0))
+ciphers_dir=${templates_dir}/..
+scripts_dir=${ciphers_dir}/../../scripts
+
+
+join ()
+{
+    local IFS=,
+    local joined="$*"
+    echo "${joined//,/, }"
+}
+
+# List the objects a template mode compiles, for implementation.info.
+code_objects ()
+{
+    local template=$1 mode=$2
+    local objects=()
+
+    for f in ${template}/!(api).[cS] ${template}/${mode}/*.[cS]
+    do
+        objects+=($(basename ${f%.*}))
+    done
+
+    echo ${objects[@]}
+}
+
+# Authors to credit in a generated implementation.info.
+template_authors ()
+{
+    local template=$1 mode=$2
+    local info template_authors=
+
+    if [ -n "${authors}" ]
+    then
+        echo ${authors}
+        return
+    fi
+
+    for info in ${template}/{i,ii}/implementation.info \
+                ${templates_dir}/Lilliput_vfelicsref/${mode}/implementation.info
+    do
+        if [ -f ${info} ]
+        then
+            template_authors=$(sed -n 's/^ImplementationAuthors: *//p' ${info})
+            break
+        fi
+    done
+
+    case ${template_authors} in
+        *"FELICS-AE contributors"*)
+            echo ${template_authors}
+            ;;
+        "")
+            echo FELICS-AE contributors
+            ;;
+        *)
+            echo ${template_authors}, FELICS-AE contributors
+    esac
+}
+
+emit_implementation_info ()
+{
+    local version=$1 mode=$2 info=$3
+    local template=${templates_dir}/Lilliput_v${version}
+    local encrypt=(encrypt) decrypt=(decrypt)
+
+    for o in $(code_objects ${template} ${mode})
+    do
+        case ${o} in
+            encrypt|decrypt)
+                ;;
+            cipher)
+                # Only ΘCB3 needs the inverse TBC to decrypt.
+                if [ ${mode} = i ]
+                then
+                    encrypt+=(cipher!lilliput_tbc_decrypt)
+                else
+                    encrypt+=(cipher)
+                fi
+                decrypt+=(cipher)
+                ;;
+            *)
+                encrypt+=(${o})
+                decrypt+=(${o})
+        esac
+    done
+
+    cat <<EOF > ${info}
+ImplementationDescription: Implementation of Lilliput-${mode^^} generated from the ${version} template
+ImplementationAuthors: $(template_authors ${template} ${mode})
+
+EncryptCode: $(join ${encrypt[@]})
+DecryptCode: $(join ${decrypt[@]})
+EOF
+}
+
+
+generated=()
+
+for version in ${versions[@]}
+do
+    template=${templates_dir}/Lilliput_v${version}
+
+    if ! [ -d ${template} ]
+    then
+        echo "No template for ${version}: ${template} does not exist." >&2
+        exit 1
+    fi
+
+    version_modes=${modes}
+    if [ -z "${version_modes}" ]
+    then
+        for mode in i ii
+        do
+            if [ -d ${template}/${mode} ]
+            then
+                version_modes+=" ${mode}"
+            fi
+        done
+    fi
+
+    for mode in ${version_modes}
+    do
+        info=${template}/${mode}/implementation.info
+        if ! [ -f ${info} ]
+        then
+            emit_implementation_info ${version} ${mode} ${info}
+            echo "Generated $(realpath --relative-to=. ${info})."
+        fi
+
+        for keylen in ${keys}
+        do
+            variant=Lilliput-${mode^^}-${keylen}
+            new_dir=${variant}_v${version}
+
+            mkdir -p ${ciphers_dir}/${new_dir}/source
+            (
+                cd ${ciphers_dir}/${new_dir}/source
+                find . -maxdepth 1 -type l -delete
+
+                # Implementation-independent files, then template files;
+                # regular files (e.g. the _vfelicsref parameters) take
+                # precedence.
+                for f in ../../.templates/Lilliput_vfelicsref/api.h \
+                         ../../${variant}_vfelicsref/source/{test_vectors.c,parameters.h} \
+                         ../../.templates/Lilliput_v${version}/!(api).[chS] \
+                         ../../.templates/Lilliput_v${version}/${mode}/*
+                do
+                    if ! [ -e $(basename ${f}) ]
+                    then
+                        ln -s ${f} .
+                    fi
+                done
+            )
+
+            generated+=(${new_dir})
+        done
+    done
+done
+
+printf 'Generated %s\n' ${generated[@]}
+
+if ${run}
+then
+    ${scripts_dir}/felics-run ${generated[@]} ${run_options}
+fi
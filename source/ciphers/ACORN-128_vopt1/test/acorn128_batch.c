@@ -0,0 +1,44 @@
+/*
+  Batch ACORN-128 with AVX2, see acorn128_batch.h.
+
+  The seven words of the state of each stream (see utils.c in
+  ACORN-128_vopt1) are spread over seven AVX2 registers, one stream per
+  64-bit lane, and updated 32 steps at a time as in utils.c.
+  acorn128_x8_* interleaves two groups of four streams, so that their
+  updates overlap.
+*/
+
+#pragma GCC target("avx2")
+
+#include <stdint.h>
+#include <immintrin.h>
+
+#include "acorn128_batch.h"
+
+
+#define VXOR(a, b)          _mm256_xor_si256((a), (b))
+#define VAND(a, b)          _mm256_and_si256((a), (b))
+#define VANDNOT(a, b)       _mm256_andnot_si256((a), (b))
+#define VSHR(a, n)          _mm256_srli_epi64((a), (n))
+#define VSHL(a, n)          _mm256_slli_epi64((a), (n))
+#define VMAJ(x, y, z)       VXOR(VXOR(VAND((x), (y)), VAND((x), (z))), VAND((y), (z)))
+#define VCH(x, y, z)        VXOR(VAND((x), (y)), VANDNOT((x), (z)))
+
+
+static inline uint32_t load32(const uint8_t *p)
+{
+    return (uint32_t)p[0] | (uint32_t)p[1] << 8 | (uint32_t)p[2] << 16 | (uint32_t)p[3] << 24;
+}
+
+
+#define PREFIX  acorn128_x4
+#define GROUPS  1
+    #include "acorn128-timesN.inc"
+#undef PREFIX
+#undef GROUPS
+
+#define PREFIX  acorn128_x8
+#define GROUPS  2
+    #include "acorn128-timesN.inc"
+#undef PREFIX
+#undef GROUPS
@@ -0,0 +1,58 @@
+#ifndef ACORN128_BATCH_H
+#define ACORN128_BATCH_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+
+/*
+  Independent ACORN-128 streams processed together, one stream per 64-bit
+  lane of AVX2 registers (x8 interleaves two groups of four lanes).  All
+  the messages of a batch have the same length, as well as their
+  associated data; keys and nonces are per stream.
+
+  This is a library rather than a FELICS implementation, since
+  crypto_aead_encrypt/crypto_aead_decrypt only ever have one stream; it
+  is meant for processing packets in batches, since the initialization
+  dominates for short packets.  Callers must check that the processor
+  supports AVX2.  ACORN-128_vopt1/test checks every stream against that
+  implementation.
+*/
+
+
+// encrypt mlen bytes of each m[i] into c[i], followed by its 16-byte tag
+void acorn128_x4_encrypt(
+    uint8_t *const c[4],
+    const uint8_t *const m[4], size_t mlen,
+    const uint8_t *const ad[4], size_t adlen,
+    const uint8_t *const npub[4],
+    const uint8_t *const k[4]
+    );
+
+// decrypt clen bytes of each c[i] (tag included) into m[i];
+// return the mask of the streams whose tag is wrong (0 if all are right)
+int acorn128_x4_decrypt(
+    uint8_t *const m[4],
+    const uint8_t *const c[4], size_t clen,
+    const uint8_t *const ad[4], size_t adlen,
+    const uint8_t *const npub[4],
+    const uint8_t *const k[4]
+    );
+
+void acorn128_x8_encrypt(
+    uint8_t *const c[8],
+    const uint8_t *const m[8], size_t mlen,
+    const uint8_t *const ad[8], size_t adlen,
+    const uint8_t *const npub[8],
+    const uint8_t *const k[8]
+    );
+
+int acorn128_x8_decrypt(
+    uint8_t *const m[8],
+    const uint8_t *const c[8], size_t clen,
+    const uint8_t *const ad[8], size_t adlen,
+    const uint8_t *const npub[8],
+    const uint8_t *const k[8]
+    );
+
+#endif /* ACORN128_BATCH_H */
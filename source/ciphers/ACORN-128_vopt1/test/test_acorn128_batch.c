@@ -0,0 +1,120 @@
+/*
+  Checks every stream of the batch ACORN-128 of acorn128_batch.c against
+  crypto_aead_encrypt and crypto_aead_decrypt, for all lengths of
+  associated data and message up to a few words, with distinct keys,
+  nonces and contents per stream.
+*/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "api.h"
+#include "crypto_aead.h"
+#include "acorn128_batch.h"
+
+
+#define MAX_LANES   8
+#define MAX_LEN     41
+
+
+static uint32_t seed = 1;
+
+static void random_bytes(uint8_t *p, size_t len)
+{
+    size_t i;
+
+    for (i = 0; i < len; i++)
+    {
+        seed = seed * 1103515245 + 12345;
+        p[i] = (uint8_t)(seed >> 16);
+    }
+}
+
+
+typedef void (*batch_encrypt)(uint8_t *const c[], const uint8_t *const m[], size_t mlen, const uint8_t *const ad[], size_t adlen, const uint8_t *const npub[], const uint8_t *const k[]);
+typedef int (*batch_decrypt)(uint8_t *const m[], const uint8_t *const c[], size_t clen, const uint8_t *const ad[], size_t adlen, const uint8_t *const npub[], const uint8_t *const k[]);
+
+
+// run one batch of lanes streams and compare each with the one-stream API;
+// return the number of mismatches
+static int test_batch(const char *name, int lanes, batch_encrypt enc, batch_decrypt dec, size_t adlen, size_t mlen)
+{
+    uint8_t k[MAX_LANES][CRYPTO_KEYBYTES], n[MAX_LANES][CRYPTO_NPUBBYTES];
+    uint8_t ad[MAX_LANES][MAX_LEN + 1], m[MAX_LANES][MAX_LEN + 1];
+    uint8_t c[MAX_LANES][MAX_LEN + CRYPTO_ABYTES], d[MAX_LANES][MAX_LEN + 1];
+    uint8_t expected[MAX_LEN + CRYPTO_ABYTES];
+    const uint8_t *kp[MAX_LANES], *np[MAX_LANES], *adp[MAX_LANES], *mp[MAX_LANES], *cp[MAX_LANES];
+    uint8_t *co[MAX_LANES], *dout[MAX_LANES];
+    size_t clen;
+    int i, wrong, errors = 0;
+
+    for (i = 0; i < lanes; i++)
+    {
+        random_bytes(k[i], CRYPTO_KEYBYTES);
+        random_bytes(n[i], CRYPTO_NPUBBYTES);
+        random_bytes(ad[i], adlen);
+        random_bytes(m[i], mlen);
+        kp[i] = k[i]; np[i] = n[i]; adp[i] = ad[i]; mp[i] = m[i];
+        co[i] = c[i]; cp[i] = c[i]; dout[i] = d[i];
+    }
+
+    enc(co, mp, mlen, adp, adlen, np, kp);
+
+    for (i = 0; i < lanes; i++)
+    {
+        crypto_aead_encrypt(expected, &clen, m[i], mlen, ad[i], adlen, n[i], k[i]);
+        if (clen != mlen + CRYPTO_ABYTES || memcmp(c[i], expected, clen) != 0)
+        {
+            printf("%s: stream %d encrypts wrongly (adlen %zu, mlen %zu)\n", name, i, adlen, mlen);
+            errors++;
+        }
+    }
+
+    wrong = dec(dout, cp, mlen + CRYPTO_ABYTES, adp, adlen, np, kp);
+    for (i = 0; i < lanes; i++)
+    {
+        if ((wrong >> i) & 1 || memcmp(d[i], m[i], mlen) != 0)
+        {
+            printf("%s: stream %d decrypts wrongly (adlen %zu, mlen %zu)\n", name, i, adlen, mlen);
+            errors++;
+        }
+    }
+
+    // a forged tag in one stream must be reported for that stream only
+    i = (int)((adlen + mlen) % lanes);
+    c[i][mlen + mlen % CRYPTO_ABYTES] ^= 0x01;
+    wrong = dec(dout, cp, mlen + CRYPTO_ABYTES, adp, adlen, np, kp);
+    if (wrong != 1 << i)
+    {
+        printf("%s: forgery in stream %d reported as 0x%x (adlen %zu, mlen %zu)\n", name, i, wrong, adlen, mlen);
+        errors++;
+    }
+
+    return errors;
+}
+
+
+int main(void)
+{
+    size_t adlen, mlen;
+    int errors = 0;
+
+    if (!__builtin_cpu_supports("avx2"))
+    {
+        printf("skipped, AVX2 is not supported\n");
+        return 0;
+    }
+
+    for (adlen = 0; adlen <= MAX_LEN; adlen++)
+    {
+        for (mlen = 0; mlen <= MAX_LEN; mlen++)
+        {
+            errors += test_batch("acorn128_x4", 4, acorn128_x4_encrypt, acorn128_x4_decrypt, adlen, mlen);
+            errors += test_batch("acorn128_x8", 8, acorn128_x8_encrypt, acorn128_x8_decrypt, adlen, mlen);
+        }
+    }
+
+    printf("%s\n", errors ? "WRONG!" : "CORRECT!");
+    return errors != 0;
+}
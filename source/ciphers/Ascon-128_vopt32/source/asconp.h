@@ -0,0 +1 @@
+../../.templates/Ascon-p/asconp32.h
\ No newline at end of file
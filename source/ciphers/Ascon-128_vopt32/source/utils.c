@@ -1,4 +0,0 @@
-#include "utils.h"
-
-ROM_DATA_BYTE R_O[5][2] = { {9, 14}, {19, 30}, {0, 3}, {5, 8}, {3, 20} };
-ROM_DATA_BYTE R_E[5][2] = { {10, 14}, {20, 31}, {1, 3}, {5, 9}, {4, 21} };
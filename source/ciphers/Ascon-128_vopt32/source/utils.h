@@ -0,0 +1 @@
+../../Ascon-128_vopt64/source/utils.h
\ No newline at end of file
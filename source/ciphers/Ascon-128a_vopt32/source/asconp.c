@@ -0,0 +1 @@
+../../.templates/Ascon-p/asconp32.c
\ No newline at end of file
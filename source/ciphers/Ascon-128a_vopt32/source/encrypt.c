@@ -0,0 +1 @@
+../../Ascon-128a_vopt64/source/encrypt.c
\ No newline at end of file
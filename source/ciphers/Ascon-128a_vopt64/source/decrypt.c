@@ -24,6 +24,10 @@
  * You should have received a copy of the GNU General Public License
  * along with this program; if not, see <http://www.gnu.org/licenses/>.
  *
+ * Modified in 2026 by FELICS-AE contributors: the permutation and the
+ * conversions between bytes and state words come from the shared Ascon-p
+ * backend (asconp.h), so that this file serves every backend.
+ *
  */
 
 #include <stdint.h>
@@ -46,86 +50,85 @@ int crypto_aead_decrypt(
   if (clen < CRYPTO_KEYBYTES)
     return -1;
 
-  uint64_t K0 = U64BIG(((uint64_t*)k)[0]);
-  uint64_t K1 = U64BIG(((uint64_t*)k)[1]);
-  uint64_t N0 = U64BIG(((uint64_t*)npub)[0]);
-  uint64_t N1 = U64BIG(((uint64_t*)npub)[1]);
-  uint64_t x0, x1, x2, x3, x4;
-  uint64_t t0, t1, t2, t3, t4;
-  uint64_t rlen;
-  size_t i;
+  const uint64_t K0 = ascon_load(k);
+  const uint64_t K1 = ascon_load(k + 8);
+  ascon_state s;
+  uint64_t cx;
+  size_t rlen;
 
   // initialization
-  x0 = (uint64_t)((CRYPTO_KEYBYTES * 8) << 24 | (RATE * 8) << 16 | PA_ROUNDS << 8 | PB_ROUNDS << 0) << 32;
-  x1 = K0;
-  x2 = K1;
-  x3 = N0;
-  x4 = N1;
-  P12;
-  x3 ^= K0;
-  x4 ^= K1;
+  s.x[0] = ascon_word((uint64_t)(CRYPTO_KEYBYTES * 8) << 56 | (uint64_t)(RATE * 8) << 48 |
+                      (uint64_t)PA_ROUNDS << 40 | (uint64_t)PB_ROUNDS << 32);
+  s.x[1] = K0;
+  s.x[2] = K1;
+  s.x[3] = ascon_load(npub);
+  s.x[4] = ascon_load(npub + 8);
+  ascon_permute(&s, PA_ROUNDS);
+  s.x[3] ^= K0;
+  s.x[4] ^= K1;
 
   // process associated data
   if (adlen) {
     rlen = adlen;
     while (rlen >= RATE) {
-      x0 ^= U64BIG(*(uint64_t*)ad);
-      x1 ^= U64BIG(*(uint64_t*)(ad + 8));
-      P8;
+      s.x[0] ^= ascon_load(ad);
+      s.x[1] ^= ascon_load(ad + 8);
+      ascon_permute(&s, PB_ROUNDS);
       rlen -= RATE;
       ad += RATE;
     }
-    for (i = 0; i < rlen; ++i, ++ad)
-      if (i < 8)
-        x0 ^= INS_BYTE(*ad, i);
-      else
-        x1 ^= INS_BYTE(*ad, i);
-    if (rlen < 8)
-      x0 ^= INS_BYTE(0x80, rlen);
-    else
-      x1 ^= INS_BYTE(0x80, rlen);
-    P8;
+    if (rlen >= 8) {
+      s.x[0] ^= ascon_load(ad);
+      s.x[1] ^= ascon_loadbytes(ad + 8, rlen - 8);
+      s.x[1] ^= ascon_pad(rlen - 8);
+    } else {
+      s.x[0] ^= ascon_loadbytes(ad, rlen);
+      s.x[0] ^= ascon_pad(rlen);
+    }
+    ascon_permute(&s, PB_ROUNDS);
   }
-  x4 ^= 1;
+  s.x[4] ^= ascon_word(1);
 
-  // process plaintext
+  // process ciphertext
   rlen = clen - CRYPTO_KEYBYTES;
   while (rlen >= RATE) {
-    *(uint64_t*)m = U64BIG(x0) ^ *(uint64_t*)c;
-    *(uint64_t*)(m + 8) = U64BIG(x1) ^ *(uint64_t*)(c + 8);
-    x0 = U64BIG(*((uint64_t*)c));
-    x1 = U64BIG(*((uint64_t*)(c + 8)));
-    P8;
+    cx = ascon_load(c);
+    ascon_store(m, s.x[0] ^ cx);
+    s.x[0] = cx;
+    cx = ascon_load(c + 8);
+    ascon_store(m + 8, s.x[1] ^ cx);
+    s.x[1] = cx;
+    ascon_permute(&s, PB_ROUNDS);
     rlen -= RATE;
     m += RATE;
     c += RATE;
   }
-  for (i = 0; i < rlen; ++i, ++m, ++c) {
-    if (i < 8) {
-      *m = EXT_BYTE(x0, i) ^ *c;
-      x0 &= ~INS_BYTE(0xff, i);
-      x0 |= INS_BYTE(*c, i);
-    } else {
-      *m = EXT_BYTE(x1, i) ^ *c;
-      x1 &= ~INS_BYTE(0xff, i);
-      x1 |= INS_BYTE(*c, i);
-    }
+  if (rlen >= 8) {
+    cx = ascon_load(c);
+    ascon_store(m, s.x[0] ^ cx);
+    s.x[0] = cx;
+    cx = ascon_loadbytes(c + 8, rlen - 8);
+    ascon_storebytes(m + 8, s.x[1] ^ cx, rlen - 8);
+    s.x[1] = ascon_clearbytes(s.x[1], rlen - 8) ^ cx;
+    s.x[1] ^= ascon_pad(rlen - 8);
+  } else {
+    cx = ascon_loadbytes(c, rlen);
+    ascon_storebytes(m, s.x[0] ^ cx, rlen);
+    s.x[0] = ascon_clearbytes(s.x[0], rlen) ^ cx;
+    s.x[0] ^= ascon_pad(rlen);
   }
-  if (rlen < 8)
-    x0 ^= INS_BYTE(0x80, rlen);
-  else
-    x1 ^= INS_BYTE(0x80, rlen);
+  c += rlen;
 
   // finalization
-  x2 ^= K0;
-  x3 ^= K1;
-  P12;
-  x3 ^= K0;
-  x4 ^= K1;
+  s.x[2] ^= K0;
+  s.x[3] ^= K1;
+  ascon_permute(&s, PA_ROUNDS);
+  s.x[3] ^= K0;
+  s.x[4] ^= K1;
 
   // return -1 if verification fails
-  if (((uint64_t*)c)[0] != U64BIG(x3) ||
-      ((uint64_t*)c)[1] != U64BIG(x4))
+  if (ascon_load(c) != s.x[3] ||
+      ascon_load(c + 8) != s.x[4])
     return -1;
 
   // return plaintext
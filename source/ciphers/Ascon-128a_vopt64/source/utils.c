@@ -1,3 +0,0 @@
-#include "utils.h"
-
-ROM_DATA_BYTE R[5][2] = { {19, 28}, {39, 61}, {1, 6}, {10, 17}, {7, 41} };
@@ -0,0 +1 @@
+../../Elephant-160_vref/source/api.h
\ No newline at end of file
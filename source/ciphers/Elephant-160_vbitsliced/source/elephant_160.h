@@ -0,0 +1,34 @@
+#ifndef ELEPHANT_160
+#define ELEPHANT_160
+
+#define SPONGENT160
+#define BLOCK_SIZE 20
+
+/*
+ * Number of states permuted together by permutation_lanes(); on PC, the
+ * compiler maps the lanes to SIMD registers.
+ */
+#if defined(PC)
+#define SPONGENT_LANES 4
+#else
+#define SPONGENT_LANES 1
+#endif
+
+#include <stddef.h>
+
+typedef unsigned char BYTE;
+typedef size_t SIZE;
+
+void permutation(BYTE* state);
+
+// Permutes the first n (at most SPONGENT_LANES) states
+void permutation_lanes(BYTE (*states)[BLOCK_SIZE], SIZE n);
+
+void lfsr_step(BYTE* output, BYTE* input);
+
+void get_ad_block(BYTE* output, const BYTE* ad, SIZE adlen, const BYTE* npub, SIZE i);
+
+void get_c_block(BYTE* output, const BYTE* c, SIZE clen, SIZE i);
+
+
+#endif
@@ -0,0 +1,245 @@
+/*
+ * Modified in 2026 by FELICS-AE contributors: the independent
+ * permutations of the message, ciphertext and associated data blocks are
+ * run SPONGENT_LANES at a time (see permutation_lanes()), and each mask
+ * is computed once.
+ */
+#include "api.h"
+#include "crypto_aead.h"
+#include <string.h> 
+#include "elephant_160.h"
+
+BYTE rotl3(BYTE b)
+{
+    return (b << 3) | (b >> 5);
+}
+
+int constcmp(const BYTE* a, const BYTE* b, SIZE length)
+{
+    BYTE r = 0;
+
+    for (SIZE i = 0; i < length; ++i)
+        r |= a[i] ^ b[i];
+    return r; 
+}
+
+
+// State should be BLOCK_SIZE bytes long
+// Note: input may be equal to output
+void lfsr_step(BYTE* output, BYTE* input)
+{
+    BYTE temp = rotl3(input[0]) ^ (input[3] << 7) ^ (input[13] >> 7);
+    for(SIZE i = 0; i < BLOCK_SIZE - 1; ++i)
+        output[i] = input[i + 1];
+    output[BLOCK_SIZE - 1] = temp;
+}
+
+void xor_block(BYTE* state, const BYTE* block, SIZE size)
+{
+    for(SIZE i = 0; i < size; ++i)
+        state[i] ^= block[i];
+}
+
+// Write the ith assocated data block to "output".
+// The nonce is prepended and padding is added as required.
+// adlen is the length of the associated data in bytes
+void get_ad_block(BYTE* output, const BYTE* ad, SIZE adlen, const BYTE* npub, SIZE i)
+{
+    SIZE len = 0;
+    // First block contains nonce
+    // Remark: nonce may not be longer then BLOCK_SIZE
+    if(i == 0) {
+        memcpy(output, npub, CRYPTO_NPUBBYTES);
+        len += CRYPTO_NPUBBYTES;
+    }
+
+    const SIZE block_offset = i * BLOCK_SIZE - (i != 0) * CRYPTO_NPUBBYTES;
+    // If adlen is divisible by BLOCK_SIZE, add an additional padding block
+    if(i != 0 && block_offset == adlen) {
+        memset(output, 0x00, BLOCK_SIZE);
+        output[0] = 0x01;
+        return;
+    }
+    const SIZE r_outlen = BLOCK_SIZE - len;
+    const SIZE r_adlen  = adlen - block_offset;
+    // Fill with associated data if available
+    if(r_outlen <= r_adlen) { // enough AD
+        memcpy(output + len, ad + block_offset, r_outlen);
+    } else { // not enough AD, need to pad
+        if(r_adlen > 0) // ad might be nullptr
+            memcpy(output + len, ad + block_offset, r_adlen);
+        memset(output + len + r_adlen, 0x00, r_outlen - r_adlen);
+        output[len + r_adlen] = 0x01;
+    }
+}
+
+// Return the ith ciphertext block.
+// clen is the length of the ciphertext in bytes 
+void get_c_block(BYTE* output, const BYTE* c, SIZE clen, SIZE i)
+{
+    const SIZE block_offset = i * BLOCK_SIZE;
+    // If clen is divisible by BLOCK_SIZE, add an additional padding block
+    if(block_offset == clen) {
+        memset(output, 0x00, BLOCK_SIZE);
+        output[0] = 0x01;
+        return;
+    }
+    const SIZE r_clen  = clen - block_offset;
+    // Fill with ciphertext if available
+    if(BLOCK_SIZE <= r_clen) { // enough ciphertext
+        memcpy(output, c + block_offset, BLOCK_SIZE);
+    } else { // not enough ciphertext, need to pad
+        if(r_clen > 0) // c might be nullptr
+            memcpy(output, c + block_offset, r_clen);
+        memset(output + r_clen, 0x00, BLOCK_SIZE - r_clen);
+        output[r_clen] = 0x01;
+    }
+}
+
+// Permutations waiting to be run together: each input is XORed with its
+// mask before the permutation and after it, then XORed into out
+typedef struct {
+    SIZE n;
+    BYTE state[SPONGENT_LANES][BLOCK_SIZE];
+    BYTE mask[SPONGENT_LANES][BLOCK_SIZE];
+    BYTE* out[SPONGENT_LANES];
+    SIZE outlen[SPONGENT_LANES];
+} batch;
+
+static void batch_flush(batch* b)
+{
+    permutation_lanes(b->state, b->n);
+    for(SIZE j = 0; j < b->n; ++j) {
+        xor_block(b->state[j], b->mask[j], BLOCK_SIZE);
+        xor_block(b->out[j], b->state[j], b->outlen[j]);
+    }
+    b->n = 0;
+}
+
+// Adds a permutation whose input is already in the next state, and whose
+// mask is mask_a ^ mask_b (mask_b may be NULL)
+static void batch_add(batch* b, const BYTE* mask_a, const BYTE* mask_b, BYTE* out, SIZE outlen)
+{
+    BYTE* mask = b->mask[b->n];
+
+    memcpy(mask, mask_a, BLOCK_SIZE);
+    if(mask_b)
+        xor_block(mask, mask_b, BLOCK_SIZE);
+    xor_block(b->state[b->n], mask, BLOCK_SIZE);
+    b->out[b->n] = out;
+    b->outlen[b->n] = outlen;
+    if(++b->n == SPONGENT_LANES)
+        batch_flush(b);
+}
+
+// It is assumed that c is sufficiently long
+// Also, tag and c should not overlap
+void crypto_aead_impl(
+    BYTE* c, BYTE* tag, const BYTE* m, SIZE mlen, const BYTE* ad, SIZE adlen,
+    const BYTE* npub, const BYTE* k, int encrypt)
+{ 
+    // Compute number of blocks
+    const SIZE nblocks_c  = 1 + mlen / BLOCK_SIZE;
+    const SIZE nblocks_m  = (mlen % BLOCK_SIZE) ? nblocks_c : nblocks_c - 1;
+    const SIZE nblocks_ad = 1 + (CRYPTO_NPUBBYTES + adlen) / BLOCK_SIZE;
+    const SIZE nb_it = (nblocks_c + 1 > nblocks_ad - 1) ? nblocks_c + 1 : nblocks_ad - 1;
+
+    // Storage for the expanded key L
+    BYTE expanded_key[BLOCK_SIZE] = {0};
+    memcpy(expanded_key, k, CRYPTO_KEYBYTES);
+    permutation(expanded_key);
+
+    // Masks of blocks i to i + 2, rotating
+    BYTE masks[3][BLOCK_SIZE];
+    
+    // Tag buffer and initialization of tag to first AD block
+    BYTE tag_buffer[BLOCK_SIZE] = {0};
+    get_ad_block(tag_buffer, ad, adlen, npub, 0);
+
+    batch b;
+    b.n = 0;
+
+    // Message blocks i, using masks i and i + 1, and associated data
+    // blocks i + 1, using mask i + 1; when decrypting, ciphertext blocks
+    // i - 1 as well, using masks i - 1 and i + 1.
+    memcpy(masks[0], expanded_key, BLOCK_SIZE);
+    lfsr_step(masks[1], masks[0]);
+    SIZE offset = 0;
+    for(SIZE i = 0; i < nb_it; ++i) {
+        BYTE* const previous_mask = masks[(i + 2) % 3];
+        BYTE* const current_mask = masks[i % 3];
+        BYTE* const next_mask = masks[(i + 1) % 3];
+
+        if(i < nblocks_m) {
+            const SIZE r_size = (i == nblocks_m - 1) ? mlen - offset : BLOCK_SIZE;
+            memcpy(b.state[b.n], npub, CRYPTO_NPUBBYTES);
+            memset(b.state[b.n] + CRYPTO_NPUBBYTES, 0, BLOCK_SIZE - CRYPTO_NPUBBYTES);
+            memcpy(c + offset, m + offset, r_size);
+            batch_add(&b, current_mask, next_mask, c + offset, r_size);
+        }
+
+        if(!encrypt && i > 0 && i <= nblocks_c) {
+            get_c_block(b.state[b.n], m, mlen, i - 1);
+            batch_add(&b, previous_mask, next_mask, tag_buffer, BLOCK_SIZE);
+        }
+
+        if(i + 1 < nblocks_ad) {
+            get_ad_block(b.state[b.n], ad, adlen, npub, i + 1);
+            batch_add(&b, next_mask, NULL, tag_buffer, BLOCK_SIZE);
+        }
+
+        // The previous mask is no longer needed
+        lfsr_step(previous_mask, next_mask);
+        offset += BLOCK_SIZE;
+    }
+
+    // When encrypting, ciphertext blocks once they are all computed
+    if(encrypt) {
+        batch_flush(&b);
+        memcpy(masks[0], expanded_key, BLOCK_SIZE);
+        lfsr_step(masks[1], masks[0]);
+        lfsr_step(masks[2], masks[1]);
+        for(SIZE i = 0; i < nblocks_c; ++i) {
+            get_c_block(b.state[b.n], c, mlen, i);
+            batch_add(&b, masks[i % 3], masks[(i + 2) % 3], tag_buffer, BLOCK_SIZE);
+            lfsr_step(masks[i % 3], masks[(i + 2) % 3]);
+        }
+    }
+    batch_flush(&b);
+
+    // Compute tag
+    xor_block(tag_buffer, expanded_key, BLOCK_SIZE);
+    permutation(tag_buffer);
+    xor_block(tag_buffer, expanded_key, BLOCK_SIZE);
+    memcpy(tag, tag_buffer, CRYPTO_ABYTES);
+}
+
+// Remark: c must be at least mlen + CRYPTO_ABYTES long
+int crypto_aead_encrypt(
+  BYTE *c, SIZE *clen,
+  const BYTE *m, SIZE mlen,
+  const BYTE *ad, SIZE adlen,
+  const BYTE *npub,
+  const BYTE *k)
+{ 
+    *clen = mlen + CRYPTO_ABYTES;
+    BYTE tag[CRYPTO_ABYTES];
+    crypto_aead_impl(c, tag, m, mlen, ad, adlen, npub, k, 1);
+    memcpy(c + mlen, tag, CRYPTO_ABYTES); 
+    return 0;
+}
+
+int crypto_aead_decrypt(
+  BYTE *m, SIZE *mlen,
+  const BYTE *c, SIZE clen,
+  const BYTE *ad, SIZE adlen,
+  const BYTE *npub,
+  const BYTE *k)
+{
+    if(clen < CRYPTO_ABYTES)
+        return -1;
+    *mlen = clen - CRYPTO_ABYTES;
+    BYTE tag[CRYPTO_ABYTES];
+    crypto_aead_impl(m, tag, c, *mlen, ad, adlen, npub, k, 0);
+    return (constcmp(c + *mlen, tag, CRYPTO_ABYTES) == 0) ? 0 : -1;
+}
@@ -0,0 +1,153 @@
+/*
+ * Implementation based on the SPONGENT implementation at 
+ * https://sites.google.com/site/spongenthash/
+ *
+ * Modified in 2026 by FELICS-AE contributors: bitsliced Spongent-pi[160]
+ * without tables, on SPONGENT_LANES states at once.
+ *
+ * The pLayer sends bit b of nibble j to bit 40*b + j: it transposes the
+ * state seen as 40 nibbles of 4 bits.  The S-boxes are thus computed on
+ * the four 40-bit planes of the state (plane b holds bit b of every
+ * nibble), and the pLayer is the concatenation of the planes, which is
+ * regrouped into planes for the next round.  A plane is kept in a 32-bit
+ * word (nibbles 0 to 31) and the 8 low bits of another (nibbles 32 to 39).
+ */
+
+#include <stdint.h>
+#include "elephant_160.h"
+
+#define nRounds		80
+#define lfsrIV	    0x75
+
+/* Swaps the bits of b selected by mask with the bits of a n positions above */
+#define SWAPMOVE(a, b, mask, n) do {                \
+    uint32_t tmp_ = ((b) ^ ((a) >> (n))) & (mask);  \
+    (b) ^= tmp_;                                    \
+    (a) ^= tmp_ << (n);                             \
+} while (0)
+
+/* Spongent S-box on the planes x0 (least significant bit) to x3 */
+#define SBOX(x0, x1, x2, x3) do {                   \
+    uint32_t bc_ = x1 & x2, a_ = x0 ^ bc_;          \
+    uint32_t y0_ = a_ ^ x1 ^ x3;                    \
+    uint32_t y1_ = ~(a_ ^ (x3 & (a_ ^ x1 ^ x2)));   \
+    uint32_t y2_ = ~(x1 ^ x2 ^ (x3 & a_));          \
+    uint32_t y3_ = ~(x2 ^ (x0 & x1) ^               \
+        (x3 & (~(x0 | x1) ^ (x0 & x2))));           \
+    x0 = y0_; x1 = y1_; x2 = y2_; x3 = y3_;         \
+} while (0)
+
+static uint32_t load32(const BYTE* p)
+{
+	return (uint32_t)p[0] | (uint32_t)p[1] << 8 | (uint32_t)p[2] << 16 | (uint32_t)p[3] << 24;
+}
+
+static void store32(BYTE* p, uint32_t x)
+{
+	p[0] = (BYTE)x;
+	p[1] = (BYTE)(x >> 8);
+	p[2] = (BYTE)(x >> 16);
+	p[3] = (BYTE)(x >> 24);
+}
+
+BYTE lCounter(BYTE lfsr)
+{
+	lfsr = (lfsr << 1) | (((0x40 & lfsr) >> 6) ^ ((0x20 & lfsr) >> 5));
+	lfsr &= 0x7f; 
+	return lfsr;
+}
+
+BYTE retnuoCl(BYTE lfsr)
+{
+	return ((lfsr & 0x01) <<7) | ((lfsr & 0x02) << 5) | ((lfsr & 0x04) << 3)
+		| ((lfsr & 0x08) << 1) | ((lfsr & 0x10) >> 1) | ((lfsr & 0x20) >> 3)
+		| ((lfsr & 0x40) >> 5) | ((lfsr & 0x80) >> 7);		
+}
+
+/* Bits b and b + 4 of x, i.e. bit b of its two nibbles */
+static uint32_t nibbles_bit(BYTE x, int b)
+{
+	return ((x >> b) & 1) | ((x >> (b + 3)) & 2);
+}
+
+/*
+ * Runs the permutation on SPONGENT_LANES states of 5 words each, in the
+ * byte order of the state (w[i][k] holds bytes 4i to 4i + 3 of state k).
+ */
+static void permute(uint32_t w[5][SPONGENT_LANES])
+{
+	BYTE IV = lfsrIV;
+
+	for(int i = 0; i < nRounds; i++){
+		/* Counter values, on bits 0, 1 (byte 0) and 38, 39 (byte 19) of the planes */
+		BYTE INV_IV = retnuoCl(IV);
+		uint32_t l_iv[4], h_iv[4];
+		for(int b = 0; b < 4; b++){
+			l_iv[b] = nibbles_bit(IV, b);
+			h_iv[b] = nibbles_bit(INV_IV, b) << 6;
+		}
+		IV = lCounter(IV);
+
+		for(int k = 0; k < SPONGENT_LANES; k++){
+			uint32_t u0 = w[0][k], u1 = w[1][k], u2 = w[2][k], u3 = w[3][k], u4 = w[4][k];
+			uint32_t l0, l1, l2, l3, h0, h1, h2, h3;
+
+			/* Bit 4n + b of each word to bit 8b + n */
+#define UNZIP(x) do {                       \
+			SWAPMOVE(x, x, 0x0a0a0a0a, 3);  \
+			SWAPMOVE(x, x, 0x00cc00cc, 6);  \
+			SWAPMOVE(x, x, 0x0000f0f0, 12); \
+			SWAPMOVE(x, x, 0x0000ff00, 8);  \
+		} while (0)
+			UNZIP(u0); UNZIP(u1); UNZIP(u2); UNZIP(u3); UNZIP(u4);
+#undef UNZIP
+
+			/* Byte w of plane word l_b is byte b of u_w */
+			SWAPMOVE(u0, u1, 0x00ff00ff, 8);
+			SWAPMOVE(u2, u3, 0x00ff00ff, 8);
+			SWAPMOVE(u0, u2, 0x0000ffff, 16);
+			SWAPMOVE(u1, u3, 0x0000ffff, 16);
+			l0 = u0; l1 = u1; l2 = u2; l3 = u3;
+			h0 = u4 & 0xff;
+			h1 = (u4 >> 8) & 0xff;
+			h2 = (u4 >> 16) & 0xff;
+			h3 = u4 >> 24;
+
+			/* Add counter values */
+			l0 ^= l_iv[0]; l1 ^= l_iv[1]; l2 ^= l_iv[2]; l3 ^= l_iv[3];
+			h0 ^= h_iv[0]; h1 ^= h_iv[1]; h2 ^= h_iv[2]; h3 ^= h_iv[3];
+
+			/* sBoxLayer layer */
+			SBOX(l0, l1, l2, l3);
+			SBOX(h0, h1, h2, h3);
+
+			/* pLayer: concatenation of the 40-bit planes */
+			h0 &= 0xff; h1 &= 0xff; h2 &= 0xff; h3 &= 0xff;
+			w[0][k] = l0;
+			w[1][k] = h0 | l1 << 8;
+			w[2][k] = l1 >> 24 | h1 << 8 | l2 << 16;
+			w[3][k] = l2 >> 16 | h2 << 16 | l3 << 24;
+			w[4][k] = l3 >> 8 | h3 << 24;
+		}
+	}
+}
+
+void permutation_lanes(BYTE (*states)[BLOCK_SIZE], SIZE n)
+{
+	uint32_t w[5][SPONGENT_LANES] = {{0}};
+
+	for(SIZE k = 0; k < n; k++)
+		for(int i = 0; i < 5; i++)
+			w[i][k] = load32(states[k] + 4*i);
+
+	permute(w);
+
+	for(SIZE k = 0; k < n; k++)
+		for(int i = 0; i < 5; i++)
+			store32(states[k] + 4*i, w[i][k]);
+}
+
+void permutation(BYTE* state)
+{
+	permutation_lanes((BYTE (*)[BLOCK_SIZE])state, 1);
+}
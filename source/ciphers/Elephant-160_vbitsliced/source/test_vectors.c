@@ -0,0 +1 @@
+../../Elephant-160_vref/source/test_vectors.c
\ No newline at end of file
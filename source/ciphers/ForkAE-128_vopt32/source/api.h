@@ -0,0 +1 @@
+../../ForkAE-128_vref/source/api.h
\ No newline at end of file
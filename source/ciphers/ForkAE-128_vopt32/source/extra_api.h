@@ -0,0 +1 @@
+../../ForkAE-128_vref/source/extra_api.h
\ No newline at end of file
@@ -0,0 +1,770 @@
+/**
+ * ForkSkinny-128-288 and the PAEF mode, on 32-bit rows.
+ *
+ * Modified in 2026 by FELICS-AE contributors from the reference
+ * implementation: each row of the state is held in a 32-bit word, and the
+ * subtweakeys of all rounds are expanded into a flat array before a block is
+ * processed, so that both branches and the inverse rounds merely index it.
+ * The key and nonce part of this array is expanded once per message; only
+ * the flags and counter part is expanded for each block.
+ *
+ * @file forkskinny.c
+ * @author Antoon Purnal <antoon.purnal@esat.kuleuven.be>
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include "api.h"
+#include "extra_api.h"
+#include "forkskinny.h"
+#include "paef.h"
+
+#ifndef CRYPTO_BLOCKSIZE_16
+#error "Only ForkSkinny with 128-bit blocks is implemented."
+#endif
+
+///////////////////////////////skinny round.c////////////////////////////////////////
+
+// Packing of data is done as follows (state[i][j] stands for row i and column j):
+// 0  1  2  3
+// 4  5  6  7
+// 8  9 10 11
+//12 13 14 15
+//
+// Row i is held in a little-endian word: cell 4*i+j is byte j.
+
+/* 7-bit round constant */
+static const unsigned char RC[87] = {0x01, 0x03, 0x07, 0x0f, 0x1f, 0x3f, 0x7e, 0x7d, 0x7b, 0x77, 0x6f, 0x5f, 0x3e, 0x7c, 0x79, 0x73, 0x67, 0x4f, 0x1e, 0x3d, 0x7a, 0x75, 0x6b, 0x57, 0x2e, 0x5c, 0x38, 0x70, 0x61, 0x43, 0x06, 0x0d, 0x1b, 0x37, 0x6e, 0x5d, 0x3a, 0x74, 0x69, 0x53, 0x26, 0x4c, 0x18, 0x31, 0x62, 0x45, 0x0a, 0x15, 0x2b, 0x56, 0x2c, 0x58, 0x30, 0x60, 0x41, 0x02, 0x05, 0x0b, 0x17, 0x2f, 0x5e, 0x3c, 0x78, 0x71, 0x63, 0x47, 0x0e, 0x1d, 0x3b, 0x76, 0x6d, 0x5b, 0x36, 0x6c, 0x59, 0x32, 0x64, 0x49, 0x12, 0x25, 0x4a, 0x14, 0x29, 0x52, 0x24, 0x48, 0x10};
+
+/* Branch constant, row by row */
+static const uint32_t BC[4] = {0x08040201, 0x82412010, 0x28140a05, 0x8844a251};
+
+#define ROTL(x, n) (((x) << (n)) | ((x) >> (32-(n))))
+
+static uint32_t load32(const unsigned char* bytes){
+    return (uint32_t)bytes[0] | ((uint32_t)bytes[1] << 8) | ((uint32_t)bytes[2] << 16) | ((uint32_t)bytes[3] << 24);
+}
+
+static void store32(unsigned char* bytes, uint32_t x){
+    bytes[0] = x & 0xFF;
+    bytes[1] = (x >> 8) & 0xFF;
+    bytes[2] = (x >> 16) & 0xFF;
+    bytes[3] = (x >> 24) & 0xFF;
+}
+
+/* SBox */
+static const unsigned char sbox[256] = {0x65, 0x4c, 0x6a, 0x42, 0x4b, 0x63, 0x43, 0x6b, 0x55, 0x75, 0x5a, 0x7a, 0x53, 0x73, 0x5b, 0x7b,0x35, 0x8c, 0x3a, 0x81, 0x89, 0x33, 0x80, 0x3b, 0x95, 0x25, 0x98, 0x2a, 0x90, 0x23, 0x99, 0x2b,0xe5, 0xcc, 0xe8, 0xc1, 0xc9, 0xe0, 0xc0, 0xe9, 0xd5, 0xf5, 0xd8, 0xf8, 0xd0, 0xf0, 0xd9, 0xf9,0xa5, 0x1c, 0xa8, 0x12, 0x1b, 0xa0, 0x13, 0xa9, 0x05, 0xb5, 0x0a, 0xb8, 0x03, 0xb0, 0x0b, 0xb9,0x32, 0x88, 0x3c, 0x85, 0x8d, 0x34, 0x84, 0x3d, 0x91, 0x22, 0x9c, 0x2c, 0x94, 0x24, 0x9d, 0x2d,0x62, 0x4a, 0x6c, 0x45, 0x4d, 0x64, 0x44, 0x6d, 0x52, 0x72, 0x5c, 0x7c, 0x54, 0x74, 0x5d, 0x7d,0xa1, 0x1a, 0xac, 0x15, 0x1d, 0xa4, 0x14, 0xad, 0x02, 0xb1, 0x0c, 0xbc, 0x04, 0xb4, 0x0d, 0xbd,0xe1, 0xc8, 0xec, 0xc5, 0xcd, 0xe4, 0xc4, 0xed, 0xd1, 0xf1, 0xdc, 0xfc, 0xd4, 0xf4, 0xdd, 0xfd,0x36, 0x8e, 0x38, 0x82, 0x8b, 0x30, 0x83, 0x39, 0x96, 0x26, 0x9a, 0x28, 0x93, 0x20, 0x9b, 0x29,0x66, 0x4e, 0x68, 0x41, 0x49, 0x60, 0x40, 0x69, 0x56, 0x76, 0x58, 0x78, 0x50, 0x70, 0x59, 0x79,0xa6, 0x1e, 0xaa, 0x11, 0x19, 0xa3, 0x10, 0xab, 0x06, 0xb6, 0x08, 0xba, 0x00, 0xb3, 0x09, 0xbb,0xe6, 0xce, 0xea, 0xc2, 0xcb, 0xe3, 0xc3, 0xeb, 0xd6, 0xf6, 0xda, 0xfa, 0xd3, 0xf3, 0xdb, 0xfb,0x31, 0x8a, 0x3e, 0x86, 0x8f, 0x37, 0x87, 0x3f, 0x92, 0x21, 0x9e, 0x2e, 0x97, 0x27, 0x9f, 0x2f,0x61, 0x48, 0x6e, 0x46, 0x4f, 0x67, 0x47, 0x6f, 0x51, 0x71, 0x5e, 0x7e, 0x57, 0x77, 0x5f, 0x7f,0xa2, 0x18, 0xae, 0x16, 0x1f, 0xa7, 0x17, 0xaf, 0x01, 0xb2, 0x0e, 0xbe, 0x07, 0xb7, 0x0f, 0xbf,0xe2, 0xca, 0xee, 0xc6, 0xcf, 0xe7, 0xc7, 0xef, 0xd2, 0xf2, 0xde, 0xfe, 0xd7, 0xf7, 0xdf, 0xff};
+static const unsigned char sbox_inv[256] = {0xac, 0xe8, 0x68, 0x3c, 0x6c, 0x38, 0xa8, 0xec, 0xaa, 0xae, 0x3a, 0x3e, 0x6a, 0x6e, 0xea, 0xee,0xa6, 0xa3, 0x33, 0x36, 0x66, 0x63, 0xe3, 0xe6, 0xe1, 0xa4, 0x61, 0x34, 0x31, 0x64, 0xa1, 0xe4,0x8d, 0xc9, 0x49, 0x1d, 0x4d, 0x19, 0x89, 0xcd, 0x8b, 0x8f, 0x1b, 0x1f, 0x4b, 0x4f, 0xcb, 0xcf,0x85, 0xc0, 0x40, 0x15, 0x45, 0x10, 0x80, 0xc5, 0x82, 0x87, 0x12, 0x17, 0x42, 0x47, 0xc2, 0xc7,0x96, 0x93, 0x03, 0x06, 0x56, 0x53, 0xd3, 0xd6, 0xd1, 0x94, 0x51, 0x04, 0x01, 0x54, 0x91, 0xd4,0x9c, 0xd8, 0x58, 0x0c, 0x5c, 0x08, 0x98, 0xdc, 0x9a, 0x9e, 0x0a, 0x0e, 0x5a, 0x5e, 0xda, 0xde,0x95, 0xd0, 0x50, 0x05, 0x55, 0x00, 0x90, 0xd5, 0x92, 0x97, 0x02, 0x07, 0x52, 0x57, 0xd2, 0xd7,0x9d, 0xd9, 0x59, 0x0d, 0x5d, 0x09, 0x99, 0xdd, 0x9b, 0x9f, 0x0b, 0x0f, 0x5b, 0x5f, 0xdb, 0xdf,0x16, 0x13, 0x83, 0x86, 0x46, 0x43, 0xc3, 0xc6, 0x41, 0x14, 0xc1, 0x84, 0x11, 0x44, 0x81, 0xc4,0x1c, 0x48, 0xc8, 0x8c, 0x4c, 0x18, 0x88, 0xcc, 0x1a, 0x1e, 0x8a, 0x8e, 0x4a, 0x4e, 0xca, 0xce,0x35, 0x60, 0xe0, 0xa5, 0x65, 0x30, 0xa0, 0xe5, 0x32, 0x37, 0xa2, 0xa7, 0x62, 0x67, 0xe2, 0xe7,0x3d, 0x69, 0xe9, 0xad, 0x6d, 0x39, 0xa9, 0xed, 0x3b, 0x3f, 0xab, 0xaf, 0x6b, 0x6f, 0xeb, 0xef,0x26, 0x23, 0xb3, 0xb6, 0x76, 0x73, 0xf3, 0xf6, 0x71, 0x24, 0xf1, 0xb4, 0x21, 0x74, 0xb1, 0xf4,0x2c, 0x78, 0xf8, 0xbc, 0x7c, 0x28, 0xb8, 0xfc, 0x2a, 0x2e, 0xba, 0xbe, 0x7a, 0x7e, 0xfa, 0xfe,0x25, 0x70, 0xf0, 0xb5, 0x75, 0x20, 0xb0, 0xf5, 0x22, 0x27, 0xb2, 0xb7, 0x72, 0x77, 0xf2, 0xf7,0x2d, 0x79, 0xf9, 0xbd, 0x7d, 0x29, 0xb9, 0xfd, 0x2b, 0x2f, 0xbb, 0xbf, 0x7b, 0x7f, 0xfb, 0xff};
+
+/* SBox on the four cells of a row */
+static uint32_t SubCell(uint32_t x){
+    return (uint32_t)sbox[x & 0xFF] | ((uint32_t)sbox[(x >> 8) & 0xFF] << 8)
+        | ((uint32_t)sbox[(x >> 16) & 0xFF] << 16) | ((uint32_t)sbox[x >> 24] << 24);
+}
+
+static uint32_t SubCell_inv(uint32_t x){
+    return (uint32_t)sbox_inv[x & 0xFF] | ((uint32_t)sbox_inv[(x >> 8) & 0xFF] << 8)
+        | ((uint32_t)sbox_inv[(x >> 16) & 0xFF] << 16) | ((uint32_t)sbox_inv[x >> 24] << 24);
+}
+
+/* One round: SubCell, AddConstants and AddKey (constants of the two top rows
+ * are in the subtweakey), ShiftRows, MixColumn */
+static void skinny_round(uint32_t state[4], const uint32_t rtk[2]){
+    uint32_t s0, s1, s2, s3;
+
+    s0 = SubCell(state[0]) ^ rtk[0];
+    s1 = SubCell(state[1]) ^ rtk[1];
+    s2 = SubCell(state[2]) ^ 0x2;
+    s3 = SubCell(state[3]);
+
+    s1 = ROTL(s1, 8);
+    s2 = ROTL(s2, 16);
+    s3 = ROTL(s3, 24);
+
+    s1 ^= s2;
+    s2 ^= s0;
+    s3 ^= s2;
+
+    state[0] = s3;
+    state[1] = s0;
+    state[2] = s1;
+    state[3] = s2;
+}
+
+static void skinny_round_inv(uint32_t state[4], const uint32_t rtk[2]){
+    uint32_t s0, s1, s2, s3;
+
+    s0 = state[1];
+    s1 = state[2];
+    s2 = state[3];
+    s3 = state[0];
+
+    s3 ^= s2;
+    s2 ^= s0;
+    s1 ^= s2;
+
+    s1 = ROTL(s1, 24);
+    s2 = ROTL(s2, 16);
+    s3 = ROTL(s3, 8);
+
+    state[0] = SubCell_inv(s0 ^ rtk[0]);
+    state[1] = SubCell_inv(s1 ^ rtk[1]);
+    state[2] = SubCell_inv(s2 ^ 0x2);
+    state[3] = SubCell_inv(s3);
+}
+
+/* Tweakey permutation on the four rows of a tweakey state */
+#define PERMUTE_TK(row0, row1, row2, row3) do { \
+    uint32_t t3 = ROTL(row3, 16); \
+    uint32_t t0 = ((row2 >> 8) & 0x000000FF) | ((row2 << 16) & 0x00FF0000) | (t3 & 0xFF00FF00); \
+    row3 = row1; \
+    row1 = ((row2 >> 16) & 0x000000FF) | (row2 & 0xFF000000) | ((t3 << 8) & 0x0000FF00) | (t3 & 0x00FF0000); \
+    row2 = row0; \
+    row0 = t0; \
+} while (0)
+
+/* LFSRs of TK2 and TK3, on the four cells of a row */
+#define LFSR2(x) ((((x) << 1) & 0xFEFEFEFE) ^ ((((x) >> 7) ^ ((x) >> 5)) & 0x01010101))
+#define LFSR3(x) ((((x) >> 1) & 0x7F7F7F7F) ^ ((((x) << 7) ^ ((x) << 1)) & 0x80808080))
+
+/* Add the contribution of one tweakey state TKk (k = 1, 2, 3) to the
+ * subtweakeys of every round */
+static void expandTweakey(forkskinny_schedule* schedule, const unsigned char* tk, int k){
+    uint32_t row0, row1, row2, row3;
+    int i;
+
+    row0 = load32(tk);
+    row1 = load32(tk+4);
+    row2 = load32(tk+8);
+    row3 = load32(tk+12);
+
+    for(i = 0; i < FORKSKINNY_ROUNDS; i++){
+        schedule->rtk[i][0] ^= row0;
+        schedule->rtk[i][1] ^= row1;
+
+        // update the subtweakey state with the permutation
+        PERMUTE_TK(row0, row1, row2, row3);
+
+        // update the subtweakey state with the LFSRs (upper two rows only)
+        if (k == 2){
+            row0 = LFSR2(row0);
+            row1 = LFSR2(row1);
+        }
+        else if (k == 3){
+            row0 = LFSR3(row0);
+            row1 = LFSR3(row1);
+        }
+    }
+}
+
+/* Expand the whole tweakey, round constants included */
+void forkSchedule(forkskinny_schedule* schedule, const unsigned char* userkey){
+    int i, k;
+
+    for(i = 0; i < FORKSKINNY_ROUNDS; i++){
+        schedule->rtk[i][0] = (RC[i] & 0xf) ^ ((uint32_t)0x2 << 16); // 4-3-2-1, and tweak material
+        schedule->rtk[i][1] = (RC[i] >> 4) & 0x7; // 7-6-5
+    }
+
+    for(k = 0; k < TWEAKEY_BLOCKSIZE_RATIO; k++)
+        expandTweakey(schedule, userkey+16*k, k+1);
+}
+
+#if CRYPTO_KEYBYTES+CRYPTO_NPUBBYTES < 16 || CRYPTO_TWEAKEYSIZE > 48
+#error "The flags and counter are expected in TK2 and TK3."
+#endif
+
+/* Expand the flags and counter part of the tweakey on top of base, the
+ * schedule of the same tweakey with flags and counter set to zero: this part
+ * only spans the last row of TK2 and the first row of TK3 */
+void forkScheduleTweak(forkskinny_schedule* schedule, const forkskinny_schedule* base, const unsigned char* userkey){
+    unsigned char tweak[2*CRYPTO_BLOCKSIZE];
+    uint32_t tk2[4], tk3[4];
+    int i;
+
+    memset(tweak, 0, sizeof(tweak));
+    memcpy(tweak+CRYPTO_KEYBYTES+CRYPTO_NPUBBYTES-16, userkey+CRYPTO_KEYBYTES+CRYPTO_NPUBBYTES, CRYPTO_TWEAKSIZE-CRYPTO_NPUBBYTES);
+
+    for(i = 0; i < 4; i++){
+        tk2[i] = load32(tweak+4*i);
+        tk3[i] = load32(tweak+16+4*i);
+    }
+
+    for(i = 0; i < FORKSKINNY_ROUNDS; i++){
+        schedule->rtk[i][0] = base->rtk[i][0] ^ tk2[0] ^ tk3[0];
+        schedule->rtk[i][1] = base->rtk[i][1] ^ tk2[1] ^ tk3[1];
+
+        PERMUTE_TK(tk2[0], tk2[1], tk2[2], tk2[3]);
+        PERMUTE_TK(tk3[0], tk3[1], tk3[2], tk3[3]);
+
+        tk2[0] = LFSR2(tk2[0]);
+        tk2[1] = LFSR2(tk2[1]);
+        tk3[0] = LFSR3(tk3[0]);
+        tk3[1] = LFSR3(tk3[1]);
+    }
+}
+
+//////////////////////////////////paef.c////////////////////////////////////////////////
+
+#define MAX_COUNTER_BITS ((((CRYPTO_TWEAKSIZE-CRYPTO_NPUBBYTES) << 3) - 3))
+
+int paef_encrypt(
+    unsigned char *c,
+    const unsigned char *m, unsigned long long mlen,
+    const unsigned char *ad, unsigned long long adlen,
+    const unsigned char *npub, // nonce, of which the length is specified in api.h
+    const unsigned char *k) { // key, of which the length is specified in api.h
+
+    /* Declarations */
+    uint64_t i, j;
+    unsigned char A_j[CRYPTO_BLOCKSIZE], M_j[CRYPTO_BLOCKSIZE];
+    unsigned char C0[CRYPTO_BLOCKSIZE], C1[CRYPTO_BLOCKSIZE];
+    unsigned char tweakey[TWEAKEY_BLOCKSIZE_RATIO*CRYPTO_BLOCKSIZE];
+    forkskinny_schedule base, schedule;
+    unsigned char running_tag[CRYPTO_BLOCKSIZE];
+
+    uint64_t nbABlocks = adlen / CRYPTO_BLOCKSIZE;
+    uint64_t nbMBlocks = mlen / CRYPTO_BLOCKSIZE;
+
+    unsigned char AD[(nbABlocks+1)*CRYPTO_BLOCKSIZE], M[(nbMBlocks+1)*CRYPTO_BLOCKSIZE]; /* Allocate one more block in case padding is needed */
+
+    uint64_t last_m_block_size = mlen % CRYPTO_BLOCKSIZE;
+
+    uint8_t ad_incomplete = (adlen != nbABlocks*CRYPTO_BLOCKSIZE) | ((adlen == 0) & (mlen == 0));  /* Boolean flag to indicate whether the final block is complete */
+    uint8_t m_incomplete = (last_m_block_size != 0);  /* Boolean flag to indicate whether the final block is complete */
+
+    /* Check if ad length not too large */
+    if ((uint64_t)(adlen / (uint64_t) CRYPTO_BLOCKSIZE) > (uint64_t) ((uint64_t)1 << MAX_COUNTER_BITS)){
+        //printf("Error: AD too long! Terminating. \n");
+        return -1;
+    }
+
+    /* Check if message length not too large */
+    if ((uint64_t)(mlen / (uint64_t) CRYPTO_BLOCKSIZE) > (uint64_t) ((uint64_t)1 << MAX_COUNTER_BITS)){
+       // printf("Error: M too long! Terminating. \n");
+        return -1;
+    }
+
+    memset(running_tag, 0, CRYPTO_BLOCKSIZE); /* Set running tag to zero */
+
+    /* Padding of A */
+    for (i = 0; i < adlen; i++)
+        AD[i] = ad[i];
+
+    /* Pad A if it is incomplete OR if it is empty and there is no message either*/
+    if (ad_incomplete)
+        nbABlocks++;
+
+    AD[adlen] = 0x80;
+    for (i = adlen+1; i < nbABlocks*CRYPTO_BLOCKSIZE; i++)
+        AD[i] = 0x00;
+
+    /* Pad M if it is incomplete */
+    if (last_m_block_size != 0)
+        nbMBlocks++;
+
+    for (i = 0; i < mlen; i++)
+        M[i] = m[i];
+
+    M[mlen] = 0x80;
+    for (i = mlen+1; i < nbMBlocks*CRYPTO_BLOCKSIZE; i++)
+        M[i] = 0x00;
+
+    /* Construct baseline tweakey: key and nonce part remains unchanged throughout the execution. Initialize the remainder of the tweakey state to zero. */
+    // Key
+    for (i = 0; i < CRYPTO_KEYBYTES; i++)
+        tweakey[i] = k[i];
+
+    // Nonce
+    for (i = 0; i < CRYPTO_NPUBBYTES; i++)
+        tweakey[CRYPTO_KEYBYTES+i] = npub[i];
+
+    // Flags and counter to zero
+    for (i = 0; i < CRYPTO_TWEAKEYSIZE-CRYPTO_KEYBYTES-CRYPTO_NPUBBYTES; i++) {
+        tweakey[CRYPTO_KEYBYTES+CRYPTO_NPUBBYTES+i] = 0;
+    }
+
+    // For ForkSkinny-128-192 and ForkSkinny-128-288, the tweakey state needs to be zero-padded.
+    for (i = CRYPTO_TWEAKEYSIZE; i < TWEAKEY_BLOCKSIZE_RATIO*CRYPTO_BLOCKSIZE; i++)
+        tweakey[i] = 0;
+
+    /* Expand the key and nonce part of the subtweakeys once */
+    forkSchedule(&base, tweakey);
+
+    /* Processing associated data */
+    for (j = 1; j <= nbABlocks; j++) {
+
+        /* Load next block */
+        for (i = 0; i < CRYPTO_BLOCKSIZE; i++)
+            A_j[i] = AD[(j-1)*CRYPTO_BLOCKSIZE+i];
+
+        /* Tweakey flags */
+        if ((j==nbABlocks) & ad_incomplete)
+            tweakey[CRYPTO_KEYBYTES+CRYPTO_NPUBBYTES] = 0x60; // Flag 011
+        else if (j==nbABlocks)
+            tweakey[CRYPTO_KEYBYTES+CRYPTO_NPUBBYTES] = 0x20; // Flag 001
+        else
+            tweakey[CRYPTO_KEYBYTES+CRYPTO_NPUBBYTES] = 0x00; // Flag 000
+
+        /* Counter */
+        for (i = 1; i < CRYPTO_TWEAKSIZE-CRYPTO_NPUBBYTES; i++)
+            tweakey[CRYPTO_TWEAKEYSIZE-i] = (j >> 8*(i-1)) & 0xff;
+
+        /* Special treatment for the tweak byte that is shared between the counter and the flags */
+        tweakey[CRYPTO_KEYBYTES+CRYPTO_NPUBBYTES] ^= (j >> 8*(CRYPTO_TWEAKSIZE-CRYPTO_NPUBBYTES-1)) & 0xff;
+
+        /* ForkEncrypt */
+        forkScheduleTweak(&schedule, &base, tweakey);
+        forkEncrypt(C0, C1, A_j, &schedule, ENC_C1);
+
+        /* Update running tag */
+        for (i = 0; i < CRYPTO_BLOCKSIZE; i++)
+            running_tag[i] ^= C1[i];
+    }
+
+    if (mlen == 0) /* If message is empty, copy tag to output buffer */
+        for (i = 0; i < CRYPTO_BLOCKSIZE; i++)
+            c[i] = running_tag[i];
+
+    /* Processing message */
+    for (j = 1; j <= nbMBlocks; j++) {
+
+        /* Load next block */
+        for (i = 0; i < CRYPTO_BLOCKSIZE; i++)
+            M_j[i] = M[(j-1)*CRYPTO_BLOCKSIZE+i];
+
+        /* Tweakey flags */
+        if ((j==nbMBlocks) & m_incomplete)
+            tweakey[CRYPTO_KEYBYTES+CRYPTO_NPUBBYTES] = 0xE0; // Flag 111
+        else if (j==nbMBlocks)
+            tweakey[CRYPTO_KEYBYTES+CRYPTO_NPUBBYTES] = 0xA0; // Flag 101
+        else
+            tweakey[CRYPTO_KEYBYTES+CRYPTO_NPUBBYTES] = 0x80; // Flag 100
+
+        /* Counter */
+        for (i = 1; i < CRYPTO_TWEAKSIZE-CRYPTO_NPUBBYTES; i++)
+            tweakey[CRYPTO_TWEAKEYSIZE-i] = (j >> 8*(i-1)) & 0xff;
+
+        /* Special treatment for the tweak byte that is shared between the counter and the flags */
+        tweakey[CRYPTO_KEYBYTES+CRYPTO_NPUBBYTES] ^= (j >> 8*(CRYPTO_TWEAKSIZE-CRYPTO_NPUBBYTES-1)) & 0xff;
+
+        /* ForkEncrypt */
+        forkScheduleTweak(&schedule, &base, tweakey);
+        forkEncrypt(C0, C1, M_j, &schedule, ENC_BOTH);
+
+        /* Final incomplete block */
+        if ((j==nbMBlocks) & m_incomplete){
+
+            /* Add running tag to C0 and move to ciphertext output */
+            for (i = 0; i < CRYPTO_BLOCKSIZE; i++)
+                c[(j-1)*CRYPTO_BLOCKSIZE+i] = C0[i] ^ running_tag[i];
+
+            /* C1 now contains the tag. Move it to ciphertext output */
+            for (i = 0; i < last_m_block_size; i++)
+                c[mlen+CRYPTO_BLOCKSIZE-last_m_block_size+i] = C1[i];
+        }
+
+        /* Final complete block */
+        else if (j==nbMBlocks){
+
+            /* Add running tag to C0 and move to ciphertext output */
+            for (i = 0; i < CRYPTO_BLOCKSIZE; i++)
+                c[(j-1)*CRYPTO_BLOCKSIZE+i] = C0[i] ^ running_tag[i];
+
+            /* C1 now contains the tag. Move it to ciphertext output */
+            for (i = 0; i < CRYPTO_BLOCKSIZE; i++)
+                c[mlen+i] = C1[i];
+        }
+
+        /* Non-final block */
+        else{
+
+            /* C0 contains ciphertext block. Move it to ciphertext output */
+            for (i = 0; i < CRYPTO_BLOCKSIZE; i++)
+                c[(j-1)*CRYPTO_BLOCKSIZE+i] = C0[i];
+
+            /* Update running tag with C1 value */
+            for (i = 0; i < CRYPTO_BLOCKSIZE; i++)
+                running_tag[i] ^= C1[i];
+        }
+    }
+
+    return 0; // all is well
+}
+
+int paef_decrypt(
+	unsigned char *m,
+	const unsigned char *c,unsigned long long clen,
+	const unsigned char *ad,unsigned long long adlen,
+	const unsigned char *npub,
+	const unsigned char *k){
+
+    /* Declarations */
+    uint64_t i,j;
+    uint8_t res = 0;
+    unsigned char running_tag[CRYPTO_BLOCKSIZE];
+    unsigned char tweakey[TWEAKEY_BLOCKSIZE_RATIO*CRYPTO_BLOCKSIZE];
+    forkskinny_schedule base, schedule;
+    unsigned char P[CRYPTO_BLOCKSIZE], C0[CRYPTO_BLOCKSIZE], C1[CRYPTO_BLOCKSIZE];
+
+    uint64_t nbABlocks = adlen / CRYPTO_BLOCKSIZE;
+    uint64_t nbMBlocks = clen / CRYPTO_BLOCKSIZE - 1;
+
+    unsigned char A_j[CRYPTO_BLOCKSIZE], C_j[CRYPTO_BLOCKSIZE];
+    unsigned char AD[(nbABlocks+1) * CRYPTO_BLOCKSIZE]; /* Allocate one more block in case padding is needed */
+
+    uint8_t ad_incomplete = (adlen != nbABlocks*CRYPTO_BLOCKSIZE) | ((adlen == 0) & (clen == CRYPTO_BLOCKSIZE));  /* Boolean flag to indicate whether the final block is complete */
+    uint8_t c_incomplete = (clen % CRYPTO_BLOCKSIZE != 0);  /* Boolean flags to indicate whether the final block is complete */
+
+    uint64_t last_c_block_size = clen % CRYPTO_BLOCKSIZE;
+
+    /* Check if ad length not too large */
+    if ((uint64_t)(adlen / (uint64_t) CRYPTO_BLOCKSIZE) > (uint64_t) ((uint64_t)1 << MAX_COUNTER_BITS)){
+        //printf("Error: AD too long! Terminating. \n");
+        return -1;
+    }
+
+    /* Check if message length not too large */
+    if ((uint64_t)((uint64_t)(clen - (uint64_t) CRYPTO_BLOCKSIZE) / (uint64_t) CRYPTO_BLOCKSIZE) > (uint64_t) ((uint64_t)1 << MAX_COUNTER_BITS)){
+       // printf("Error: M too long! Terminating. \n");
+        return -1;
+    }
+
+    memset(running_tag, 0, CRYPTO_BLOCKSIZE); /* Set running tag to zero */
+
+    /* Padding of A */
+    for (i = 0; i < adlen; i++)
+        AD[i] = ad[i];
+
+    /* Pad A if it is incomplete OR if it is empty and there is no message either*/
+    if (ad_incomplete)
+        nbABlocks++;
+
+    AD[adlen] = 0x80;
+    for (i = adlen+1; i < nbABlocks*CRYPTO_BLOCKSIZE; i++)
+        AD[i] = 0x00;
+
+    /* Message was padded */
+    if (c_incomplete)
+        nbMBlocks++;
+
+    /* Construct baseline tweakey: key and nonce part remains unchanged throughout the execution. Initialize the remainder of the tweakey state to zero. */
+    // Key
+    for (i = 0; i < CRYPTO_KEYBYTES; i++)
+        tweakey[i] = k[i];
+
+    // Nonce
+    for (i = 0; i < CRYPTO_NPUBBYTES; i++)
+        tweakey[CRYPTO_KEYBYTES+i] = npub[i];
+
+    // Flags and counter to zero
+    for (i = 0; i < CRYPTO_TWEAKEYSIZE-CRYPTO_KEYBYTES-CRYPTO_NPUBBYTES; i++)
+        tweakey[CRYPTO_KEYBYTES+CRYPTO_NPUBBYTES+i] = 0;
+
+    // For ForkSkinny-128-192 and ForkSkinny-128-288, the tweakey state needs to be zero-padded.
+    for (i = CRYPTO_TWEAKEYSIZE; i < TWEAKEY_BLOCKSIZE_RATIO*CRYPTO_BLOCKSIZE; i++)
+        tweakey[i] = 0;
+
+    /* Expand the key and nonce part of the subtweakeys once */
+    forkSchedule(&base, tweakey);
+
+    /* Processing associated data */
+    for (j = 1; j <= nbABlocks; j++) {
+
+        /* Load next block */
+        for (i = 0; i < CRYPTO_BLOCKSIZE; i++)
+            A_j[i] = AD[(j-1)*CRYPTO_BLOCKSIZE+i];
+
+        /* Tweakey flags */
+        if ((j==nbABlocks) & ad_incomplete)
+            tweakey[CRYPTO_KEYBYTES+CRYPTO_NPUBBYTES] = 0x60; // Flag 011
+        else if (j==nbABlocks)
+            tweakey[CRYPTO_KEYBYTES+CRYPTO_NPUBBYTES] = 0x20; // Flag 001
+        else
+            tweakey[CRYPTO_KEYBYTES+CRYPTO_NPUBBYTES] = 0x00; // Flag 000
+
+        /* Counter */
+        for (i = 1; i < CRYPTO_TWEAKSIZE-CRYPTO_NPUBBYTES; i++)
+            tweakey[CRYPTO_TWEAKEYSIZE-i] = (j >> 8*(i-1)) & 0xff;
+
+        /* Special treatment for the tweak byte that is shared between the counter and the flags */
+        tweakey[CRYPTO_KEYBYTES+CRYPTO_NPUBBYTES] ^= (j >> 8*(CRYPTO_TWEAKSIZE-CRYPTO_NPUBBYTES-1)) & 0xff;
+
+        /* ForkEncrypt */
+        forkScheduleTweak(&schedule, &base, tweakey);
+        forkEncrypt(C0, C1, A_j, &schedule, ENC_C1);
+
+        /* Update running tag */
+        for (i = 0; i < CRYPTO_BLOCKSIZE; i++)
+            running_tag[i] ^= C1[i];
+    }
+
+    if (clen == CRYPTO_BLOCKSIZE) /* If message is empty, copy tag to output buffer */
+        for (i = 0; i < CRYPTO_BLOCKSIZE; i++)
+            C1[i] = running_tag[i];
+
+    /* Process ciphertext */
+    for (j = 1; j <= nbMBlocks; j++) {
+
+        /* Final ciphertext block: XOR with running tag*/
+        if (j==nbMBlocks)
+            for (i = 0; i < CRYPTO_BLOCKSIZE; i++)
+                C_j[i] = c[(j-1)*CRYPTO_BLOCKSIZE+i] ^ running_tag[i]; // C0 is running tag xor C*
+
+        /* Non-final ciphertext block*/
+        else
+            for (i = 0; i < CRYPTO_BLOCKSIZE; i++)
+                C_j[i] = c[(j-1)*CRYPTO_BLOCKSIZE+i];
+
+        /* Tweakey flags */
+        if ((j==nbMBlocks) & c_incomplete)
+            tweakey[CRYPTO_KEYBYTES+CRYPTO_NPUBBYTES] = 0xE0; // Flag 111
+        else if (j==nbMBlocks)
+            tweakey[CRYPTO_KEYBYTES+CRYPTO_NPUBBYTES] = 0xA0; // Flag 101
+        else
+            tweakey[CRYPTO_KEYBYTES+CRYPTO_NPUBBYTES] = 0x80; // Flag 100
+
+        /* Counter */
+        for (i = 1; i < CRYPTO_TWEAKSIZE-CRYPTO_NPUBBYTES; i++)
+            tweakey[CRYPTO_TWEAKEYSIZE-i] = (j >> 8*(i-1)) & 0xff;
+
+        /* Special treatment for the tweak byte that is shared between the counter and the flags */
+        tweakey[CRYPTO_KEYBYTES+CRYPTO_NPUBBYTES] ^= (j >> 8*(CRYPTO_TWEAKSIZE-CRYPTO_NPUBBYTES-1)) & 0xff;
+
+        /* ForkInvert */
+        forkScheduleTweak(&schedule, &base, tweakey);
+        forkInvert(P, C1, C_j, &schedule, 0, INV_BOTH);
+
+        /* Final incomplete block */
+        if ((j==nbMBlocks) & c_incomplete)
+            for (i = 0; i < last_c_block_size; i++) // Move incomplete P to plaintext output
+                m[(j-1)*CRYPTO_BLOCKSIZE+i] = P[i];
+
+        /* Final block */
+        else if (j==nbMBlocks)
+            for (i = 0; i < CRYPTO_BLOCKSIZE; i++) // Move complete P to plaintext output
+                m[(j-1)*CRYPTO_BLOCKSIZE+i] = P[i];
+
+        else{
+            for (i = 0; i < CRYPTO_BLOCKSIZE; i++) // Move complete P to plaintext output
+                m[(j-1)*CRYPTO_BLOCKSIZE+i] = P[i];
+
+            for (i = 0; i < CRYPTO_BLOCKSIZE; i++) // Add C1 to running tag
+                running_tag[i] ^= C1[i];
+        }
+    }
+
+    /* Check if the tag (C1) is correct, if incorrect output error (denoted by -1) */
+
+    /* Does the tag part match? */
+    if (c_incomplete){
+        for (i = 0; i < last_c_block_size; i++)
+            if (C1[i] != c[clen-last_c_block_size+i]){
+                res = -1;
+            }
+    }
+    else{
+        for (i = 0; i < CRYPTO_BLOCKSIZE; i++)
+            if (C1[i] != c[clen-CRYPTO_BLOCKSIZE+i]){
+                res = -1;
+            }
+    }
+
+    /* If incomplete: does the plaintext redundancy match? */
+    if (c_incomplete){
+        if (P[last_c_block_size] != 0x80){
+            res = -1;
+        }
+        for (i = 1; i < CRYPTO_BLOCKSIZE-last_c_block_size; i++)
+            if (P[last_c_block_size+i] != 0x00){
+                res = -1;
+            }
+        }
+
+    return res;
+}
+
+/////////////////////////////////forkeskinny//////////////////////////////////////
+
+static void AddBranchConstant(uint32_t state[4]){
+    int i;
+
+    for(i = 0; i < 4; i++)
+        state[i] ^= BC[i];
+}
+
+static void loadState(uint32_t state[4], const unsigned char* input){
+    int i;
+
+    for(i = 0; i < 4; i++)
+        state[i] = load32(input+4*i);
+}
+
+static void stateToCharArray(unsigned char* array, const uint32_t state[4]){
+    int i;
+
+    for(i = 0; i < 4; i++)
+        store32(array+4*i, state[i]);
+}
+
+void forkEncrypt(unsigned char* C0, unsigned char* C1, const unsigned char* input, const forkskinny_schedule* schedule, const enum encrypt_selector s){
+
+	uint32_t state[4], L[4];
+    int i;
+
+    loadState(state, input);
+
+    /* Before fork */
+	for(i = 0; i < CRYPTO_NBROUNDS_BEFORE; i++)
+        skinny_round(state, schedule->rtk[i]);
+
+    /* Keep the fork for the left branch */
+    memcpy(L, state, sizeof(L));
+
+    /* Right branch (C1) */
+    if ((s == ENC_C1) | (s == ENC_BOTH)){
+
+        for(i = CRYPTO_NBROUNDS_BEFORE; i < CRYPTO_NBROUNDS_BEFORE+CRYPTO_NBROUNDS_AFTER; i++)
+            skinny_round(state, schedule->rtk[i]);
+
+        /* Move result to output buffer*/
+        stateToCharArray(C1, state);
+    }
+
+    /* Left branch (C0) */
+    if ((s == ENC_C0) | (s == ENC_BOTH)){
+
+        /* Add branch constant */
+        AddBranchConstant(L);
+
+        for(i = CRYPTO_NBROUNDS_BEFORE+CRYPTO_NBROUNDS_AFTER; i < CRYPTO_NBROUNDS_BEFORE+2*CRYPTO_NBROUNDS_AFTER; i++)
+            skinny_round(L, schedule->rtk[i]);
+
+        /* Move result to output buffer */
+        stateToCharArray(C0, L);
+    }
+}
+
+void forkInvert(unsigned char* inverse, unsigned char* C_other, const unsigned char* input, const forkskinny_schedule* schedule, uint8_t b, const enum inversion_selector s){
+
+	uint32_t state[4], L[4];
+	int i;
+
+    loadState(state, input);
+
+    if (b == 1){
+
+        /* From C1 to fork*/
+        for(i = CRYPTO_NBROUNDS_BEFORE+CRYPTO_NBROUNDS_AFTER-1; i >= CRYPTO_NBROUNDS_BEFORE; i--)
+            skinny_round_inv(state, schedule->rtk[i]);
+
+        /* Keep the fork for the other branch */
+        memcpy(L, state, sizeof(L));
+
+        if ((s == INV_INVERSE) | (s == INV_BOTH)) {
+
+            /* From fork to M */
+            for(i = CRYPTO_NBROUNDS_BEFORE-1; i >= 0; i--)
+                skinny_round_inv(state, schedule->rtk[i]);
+
+            /* Move result to output buffer */
+            stateToCharArray(inverse, state);
+        }
+
+        if ((s == INV_OTHER) | (s == INV_BOTH)) {
+
+            /* Add branch constant */
+            AddBranchConstant(L);
+
+            /* From fork to C0 */
+            for(i = CRYPTO_NBROUNDS_BEFORE+CRYPTO_NBROUNDS_AFTER; i < CRYPTO_NBROUNDS_BEFORE+2*CRYPTO_NBROUNDS_AFTER; i++)
+                skinny_round(L, schedule->rtk[i]);
+
+            /* Move result to output buffer */
+            stateToCharArray(C_other, L);
+        }
+    }
+    else {
+
+        /* From C0 to fork */
+        for(i = CRYPTO_NBROUNDS_BEFORE+2*CRYPTO_NBROUNDS_AFTER-1; i >= CRYPTO_NBROUNDS_BEFORE+CRYPTO_NBROUNDS_AFTER; i--)
+            skinny_round_inv(state, schedule->rtk[i]);
+
+        /* Add branch constant */
+        AddBranchConstant(state);
+
+        /* Keep the fork for the other branch */
+        memcpy(L, state, sizeof(L));
+
+        if ((s == INV_BOTH) | (s == INV_INVERSE)) {
+
+            /* From fork to M */
+            for(i = CRYPTO_NBROUNDS_BEFORE-1; i >= 0; i--)
+                skinny_round_inv(state, schedule->rtk[i]);
+
+            /* Move result into output buffer */
+            stateToCharArray(inverse, state);
+        }
+
+        if ((s == INV_BOTH) | (s == INV_OTHER)) {
+
+            /* From fork to C1 */
+            for(i = CRYPTO_NBROUNDS_BEFORE; i < CRYPTO_NBROUNDS_BEFORE+CRYPTO_NBROUNDS_AFTER; i++)
+                skinny_round(L, schedule->rtk[i]);
+
+            /* Move result to output buffer */
+            stateToCharArray(C_other, L);
+        }
+    }
+}
+
+///////////////////////////////////////encrypt.c///////////////////////////////////////////////////////
+
+/**
+ * The CAESAR encrypt interface
+ * @param c A pointer to buffer for CT
+ * @param clen Ciphertext length in Bytes
+ * @param k The secret key
+ * @param m A pointer to the PT
+ * @param mlen Plaintext length in Bytes
+ * @param ad A pointer to associated data
+ * @param adlen Length of associated data in Bytes
+ * @param npub A pointer to the nonce
+ */
+int crypto_aead_encrypt(
+	uint8_t *c, size_t *clen,
+	const uint8_t *m, size_t mlen,
+	const uint8_t *ad, size_t adlen,
+	const uint8_t *npub,
+	const uint8_t *k
+) {
+   int res = paef_encrypt(c, m, mlen, ad, adlen, npub, k);
+   if (res != -1)
+      *clen = mlen + CRYPTO_ABYTES;
+   return res;
+}
+
+/**
+ * The CAESAR decrypt interface
+ * @param c A pointer to buffer for CT
+ * @param clen Ciphertext length in Bytes
+ * @param k The secret key
+ * @param m A pointer to the PT
+ * @param mlen Plaintext length in Bytes
+ * @param ad A pointer to associated data
+ * @param adlen Length of associated data  in Bytes
+ * @param npub A pointer to the nonce
+ */
+int crypto_aead_decrypt(
+	uint8_t *m, size_t *mlen,
+	const uint8_t *c, size_t clen,
+	const uint8_t *ad, size_t adlen,
+	const uint8_t *npub,
+	const uint8_t *k
+) {
+   int res = paef_decrypt(m, c, clen, ad, adlen, npub, k);
+   if (res != -1)
+    *mlen = clen - CRYPTO_ABYTES;
+   return res;
+}
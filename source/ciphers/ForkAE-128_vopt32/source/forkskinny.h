@@ -0,0 +1,47 @@
+/**
+ * The ForkSkinny construction.
+ *
+ * Round tweakeys are expanded beforehand, for the rounds of both
+ * branches, into a forkskinny_schedule.
+ *
+ * @file forkskinny.h
+ * @author Antoon Purnal <antoon.purnal@esat.kuleuven.be>
+ */
+
+#ifndef FORKSKINNY_H
+#define FORKSKINNY_H
+
+#include <stdint.h>
+
+#include "extra_api.h"
+
+#define FORKSKINNY_ROUNDS (CRYPTO_NBROUNDS_BEFORE+2*CRYPTO_NBROUNDS_AFTER)
+
+/* Two top rows of the subtweakey of every round, round constants included */
+typedef struct {
+    uint32_t rtk[FORKSKINNY_ROUNDS][2];
+} forkskinny_schedule;
+
+enum encrypt_selector {
+
+    ENC_C0, // "Left" block
+    ENC_C1, // "Right" block
+    ENC_BOTH // Both blocks
+
+};
+
+enum inversion_selector {
+
+    INV_INVERSE, // Plaintext block
+    INV_OTHER, // Other ciphertext block
+    INV_BOTH // Both blocks
+
+};
+
+void forkSchedule(forkskinny_schedule* schedule, const unsigned char* userkey);
+void forkScheduleTweak(forkskinny_schedule* schedule, const forkskinny_schedule* base, const unsigned char* userkey);
+
+void forkEncrypt(unsigned char* C0, unsigned char* C1, const unsigned char* input, const forkskinny_schedule* schedule, const enum encrypt_selector s);
+void forkInvert(unsigned char* inverse, unsigned char* C_other, const unsigned char* input, const forkskinny_schedule* schedule, uint8_t b, const enum inversion_selector s);
+
+#endif /* ifndef FORKSKINNY_H */
@@ -0,0 +1 @@
+../../ForkAE-128_vref/source/paef.h
\ No newline at end of file
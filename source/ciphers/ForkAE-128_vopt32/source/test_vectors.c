@@ -0,0 +1 @@
+../../ForkAE-128_vref/source/test_vectors.c
\ No newline at end of file
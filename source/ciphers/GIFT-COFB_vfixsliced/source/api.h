@@ -0,0 +1 @@
+../../GIFT-COFB_vref/source/api.h
\ No newline at end of file
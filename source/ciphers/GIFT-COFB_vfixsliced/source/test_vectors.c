@@ -0,0 +1 @@
+../../GIFT-COFB_vref/source/test_vectors.c
\ No newline at end of file
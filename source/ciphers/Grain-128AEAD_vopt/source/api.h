@@ -0,0 +1 @@
+../../Grain-128AEAD_vref/source/api.h
\ No newline at end of file
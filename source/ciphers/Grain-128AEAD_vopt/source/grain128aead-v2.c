@@ -0,0 +1,317 @@
+/*
+ * Word-oriented implementation of Grain128-AEADv2.
+ *
+ * The LFSR and the NFSR are kept in 32-bit words and clocked 32 times
+ * at once, which the design allows since no tap is further than bit 96.
+ * The even bits of each batch of 32 output bits are the keystream of
+ * 16 message bits, the odd bits feed the authenticator shift register.
+ *
+ * Bytes are read least significant bit first, which gives the same test
+ * vectors as the reference implementation.
+ *
+ * Based on the reference implementation by Jonathan Sönnerup.
+ * Modified in 2026 by FELICS-AE contributors: registers in words, no
+ * heap allocation.
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include "api.h"
+#include "grain128aead-v2.h"
+
+/* Bits o to o + 31 of a register, for o not a multiple of 32 */
+#define TAP(r, o) (((r)[(o) / 32] >> ((o) % 32)) | ((r)[(o) / 32 + 1] << (32 - (o) % 32)))
+
+static inline uint32_t load32(const uint8_t *p)
+{
+	return (uint32_t) p[0] | (uint32_t) p[1] << 8 | (uint32_t) p[2] << 16 | (uint32_t) p[3] << 24;
+}
+
+/*
+ * Clocks the cipher 32 times and returns the 32 output bits. During
+ * initialization, init is all ones so that the output is fed back, and
+ * the key words are re-introduced in the last 64 clocks.
+ */
+static inline uint32_t next_z(grain_state *grain, uint32_t init, uint32_t lfsr_key, uint32_t nfsr_key)
+{
+	uint32_t *l = grain->lfsr;
+	uint32_t *n = grain->nfsr;
+
+	/* f(x) = 1 + x^32 + x^47 + x^58 + x^90 + x^121 + x^128 */
+	uint32_t lfsr_fb = l[3] ^ TAP(l, 81) ^ TAP(l, 70) ^ TAP(l, 38) ^ TAP(l, 7) ^ l[0];
+
+	uint32_t nfsr_fb = n[3] ^ TAP(n, 91) ^ TAP(n, 56) ^ TAP(n, 26) ^ n[0] ^
+			(TAP(n, 84) & TAP(n, 68)) ^ (TAP(n, 67) & TAP(n, 3)) ^
+			(TAP(n, 65) & TAP(n, 61)) ^ (TAP(n, 59) & TAP(n, 27)) ^
+			(TAP(n, 48) & TAP(n, 40)) ^ (TAP(n, 18) & TAP(n, 17)) ^
+			(TAP(n, 13) & TAP(n, 11)) ^
+			(TAP(n, 82) & TAP(n, 78) & TAP(n, 70)) ^
+			(TAP(n, 25) & TAP(n, 24) & TAP(n, 22)) ^
+			(TAP(n, 95) & TAP(n, 93) & TAP(n, 92) & TAP(n, 88));
+
+	// h(x) = x0x1 + x2x3 + x4x5 + x6x7 + x0x4x8
+	uint32_t x0 = TAP(n, 12);
+	uint32_t x1 = TAP(l, 8);
+	uint32_t x2 = TAP(l, 13);
+	uint32_t x3 = TAP(l, 20);
+	uint32_t x4 = TAP(n, 95);
+	uint32_t x5 = TAP(l, 42);
+	uint32_t x6 = TAP(l, 60);
+	uint32_t x7 = TAP(l, 79);
+	uint32_t x8 = TAP(l, 94);
+	uint32_t h_out = (x0 & x1) ^ (x2 & x3) ^ (x4 & x5) ^ (x6 & x7) ^ (x0 & x4 & x8);
+
+	/* y = h + s_{i+93} + sum(b_{i+j}), j \in {2, 15, 36, 45, 64, 73, 89} */
+	uint32_t y = h_out ^ TAP(l, 93) ^ TAP(n, 2) ^ TAP(n, 15) ^ TAP(n, 36) ^
+			TAP(n, 45) ^ n[2] ^ TAP(n, 73) ^ TAP(n, 89);
+
+	uint32_t lfsr_out = l[0];
+
+	l[0] = l[1];
+	l[1] = l[2];
+	l[2] = l[3];
+	l[3] = lfsr_fb ^ (y & init) ^ lfsr_key;
+
+	n[0] = n[1];
+	n[1] = n[2];
+	n[2] = n[3];
+	n[3] = nfsr_fb ^ lfsr_out ^ (y & init) ^ nfsr_key;
+
+	return y;
+}
+
+/* Gathers the even bits of x in its 16 least significant bits */
+static inline uint32_t even_bits(uint32_t x)
+{
+	x &= 0x55555555;
+	x = (x | (x >> 1)) & 0x33333333;
+	x = (x | (x >> 2)) & 0x0f0f0f0f;
+	x = (x | (x >> 4)) & 0x00ff00ff;
+	x = (x | (x >> 8)) & 0x0000ffff;
+	return x;
+}
+
+/*
+ * Authenticates the bits bits of msg, with the bits bits of mac. The
+ * shift register seen by message bit i is the 64-bit window of mac:sr
+ * starting at bit i, so that the windows are independent of each other.
+ */
+static inline void accumulate(grain_state *grain, uint32_t msg, uint32_t mac, int bits)
+{
+	uint64_t acc = grain->auth_acc;
+	uint64_t sr = grain->auth_sr;
+
+	for (int i = 0; i < bits; i++) {
+		uint64_t window = (sr >> i) | ((uint64_t) mac << 1 << (63 - i));
+		acc ^= window & -(uint64_t) ((msg >> i) & 1);
+	}
+
+	grain->auth_acc = acc;
+	grain->auth_sr = (sr >> bits) | ((uint64_t) mac << (64 - bits));
+}
+
+/*
+ * Processes the bits bits of in (8 or 16) with the output z of 2 * bits
+ * clocks and returns the encrypted or decrypted bits.
+ */
+static inline uint32_t process_bits(grain_state *grain, uint32_t in, uint32_t z, int bits, enum GRAIN_DATA mode)
+{
+	uint32_t ks = even_bits(z);
+	uint32_t out = in ^ ks;
+
+	accumulate(grain, mode == DECRYPT ? out : in, even_bits(z >> 1), bits);
+	return out;
+}
+
+/* Processes one byte with the next 16 clocks */
+static inline uint8_t process_byte(grain_state *grain, uint8_t in, enum GRAIN_DATA mode)
+{
+	uint32_t z;
+
+	if (grain->z_left) {
+		z = grain->z >> 16;
+		grain->z_left = 0;
+	} else {
+		z = next_z(grain, 0, 0, 0);
+		grain->z = z;
+		grain->z_left = 1;
+	}
+
+	return (uint8_t) process_bits(grain, in, z & 0xffff, 8, mode);
+}
+
+void init_grain(grain_state *grain, const uint8_t *key, const uint8_t *iv)
+{
+	uint32_t k[4];
+
+	for (int i = 0; i < 4; i++) {
+		k[i] = load32(key + 4 * i);
+		grain->nfsr[i] = k[i];
+	}
+
+	/* IV bits, then 31 ones and a zero */
+	for (int i = 0; i < 3; i++) {
+		grain->lfsr[i] = load32(iv + 4 * i);
+	}
+	grain->lfsr[3] = 0x7fffffff;
+
+	/* initialize grain and skip output */
+	for (int i = 0; i < 10; i++) {
+		next_z(grain, 0xffffffff, 0, 0);
+	}
+
+	/* re-introduce the key into LFSR and NFSR in parallel during the next 64 clocks */
+	next_z(grain, 0xffffffff, k[2], k[0]);
+	next_z(grain, 0xffffffff, k[3], k[1]);
+
+	/* inititalize the accumulator and shift register */
+	grain->auth_acc = next_z(grain, 0, 0, 0);
+	grain->auth_acc |= (uint64_t) next_z(grain, 0, 0, 0) << 32;
+	grain->auth_sr = next_z(grain, 0, 0, 0);
+	grain->auth_sr |= (uint64_t) next_z(grain, 0, 0, 0) << 32;
+
+	grain->z_left = 0;
+}
+
+void process_data(grain_state *grain, uint8_t *out, const uint8_t *in, size_t len, enum GRAIN_DATA mode)
+{
+	grain_state g;
+
+	if (len == 0) {
+		return;
+	}
+
+	/* local copy, which the output bytes cannot alias */
+	g = *grain;
+
+	/* finish the clocks of the previous call */
+	if (g.z_left) {
+		uint8_t o = process_byte(&g, *in++, mode);
+		if (mode != AUTH) {
+			*out++ = o;
+		}
+		len--;
+	}
+
+	for (; len >= 2; len -= 2, in += 2) {
+		uint32_t z = next_z(&g, 0, 0, 0);
+		uint32_t o = process_bits(&g, in[0] | (uint32_t) in[1] << 8, z, 16, mode);
+		if (mode != AUTH) {
+			out[0] = (uint8_t) o;
+			out[1] = (uint8_t) (o >> 8);
+			out += 2;
+		}
+	}
+
+	if (len) {
+		uint8_t o = process_byte(&g, *in, mode);
+		if (mode != AUTH) {
+			*out = o;
+		}
+	}
+
+	*grain = g;
+}
+
+/* Writes the DER encoding of len in der, which holds 1 + sizeof(size_t) bytes */
+size_t encode_der(size_t len, uint8_t *der)
+{
+	size_t len_tmp;
+	size_t der_len = 0;
+
+	if (len < 128) {
+		der[0] = (uint8_t) len;
+		return 1;
+	}
+
+	len_tmp = len;
+	do {
+		len_tmp >>= 8;
+		der_len++;
+	} while (len_tmp != 0);
+
+	// one extra byte to describe the number of bytes used
+	der[0] = (uint8_t) (0x80 | der_len);
+
+	len_tmp = len;
+	for (size_t i = der_len; i > 0; i--) {
+		der[i] = (uint8_t) len_tmp;
+		len_tmp >>= 8;
+	}
+
+	return der_len + 1;
+}
+
+static void auth_ad(grain_state *grain, const uint8_t *ad, size_t adlen)
+{
+	uint8_t der[1 + sizeof(size_t)];
+	size_t derlen = encode_der(adlen, der);
+
+	// authenticate adlen by prepending it to ad, using DER encoding
+	process_data(grain, NULL, der, derlen, AUTH);
+	process_data(grain, NULL, ad, adlen, AUTH);
+}
+
+/*
+ * Accumulates the padding bit 1. The keystream bit clocked for it in the
+ * reference implementation is unused, so the state is not clocked.
+ */
+static uint64_t finalize(grain_state *grain)
+{
+	return grain->auth_acc ^ grain->auth_sr;
+}
+
+int crypto_aead_encrypt(uint8_t *c, size_t *clen,
+	const uint8_t *m, size_t mlen,
+	const uint8_t *ad, size_t adlen,
+	const uint8_t *npub,
+	const uint8_t *k
+	)
+{
+	grain_state grain;
+
+	init_grain(&grain, k, npub);
+	auth_ad(&grain, ad, adlen);
+	process_data(&grain, c, m, mlen, ENCRYPT);
+
+	/* append MAC to ciphertext */
+	uint64_t tag = finalize(&grain);
+	for (int i = 0; i < CRYPTO_ABYTES; i++) {
+		c[mlen + i] = (uint8_t) (tag >> (8 * i));
+	}
+
+	*clen = mlen + CRYPTO_ABYTES;
+
+	return 0;
+}
+
+int crypto_aead_decrypt(
+       uint8_t *m,size_t *mlen,
+       const uint8_t *c,size_t clen,
+       const uint8_t *ad,size_t adlen,
+       const uint8_t *npub,
+       const uint8_t *k
+     )
+{
+	grain_state grain;
+
+	if (clen < CRYPTO_ABYTES) {
+		return -1;
+	}
+
+	init_grain(&grain, k, npub);
+	auth_ad(&grain, ad, adlen);
+	process_data(&grain, m, c, clen - CRYPTO_ABYTES, DECRYPT);
+
+	*mlen = clen - CRYPTO_ABYTES;
+
+	// check MAC
+	uint64_t tag = finalize(&grain);
+	uint8_t diff = 0;
+	for (int i = 0; i < CRYPTO_ABYTES; i++) {
+		diff |= c[*mlen + i] ^ (uint8_t) (tag >> (8 * i));
+	}
+
+	return diff ? -1 : 0;
+}
@@ -0,0 +1,28 @@
+#ifndef GRAIN128AEAD_H
+#define GRAIN128AEAD_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * Bit i of the registers is bit (i % 32) of word i / 32 (resp. bit i of
+ * the 64-bit authenticator words), so that 32 clocks of the cipher
+ * shift whole words.
+ */
+typedef struct {
+	uint32_t lfsr[4];
+	uint32_t nfsr[4];
+	uint64_t auth_acc;
+	uint64_t auth_sr;
+	/* keystream of the second byte of the last 32 clocks, if unused */
+	uint32_t z;
+	uint8_t z_left;
+} grain_state;
+
+enum GRAIN_DATA {AUTH, ENCRYPT, DECRYPT};
+
+void init_grain(grain_state *grain, const uint8_t *key, const uint8_t *iv);
+void process_data(grain_state *grain, uint8_t *out, const uint8_t *in, size_t len, enum GRAIN_DATA mode);
+size_t encode_der(size_t len, uint8_t *der);
+
+#endif
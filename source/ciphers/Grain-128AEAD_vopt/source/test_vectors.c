@@ -0,0 +1 @@
+../../Grain-128AEAD_vref/source/test_vectors.c
\ No newline at end of file
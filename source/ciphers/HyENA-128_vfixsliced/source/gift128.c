@@ -0,0 +1 @@
+../../.templates/GIFT-128_vfixsliced/gift128.c
\ No newline at end of file
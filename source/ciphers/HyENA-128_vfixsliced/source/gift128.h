@@ -0,0 +1 @@
+../../.templates/GIFT-128_vfixsliced/gift128.h
\ No newline at end of file
@@ -0,0 +1,24 @@
+#ifndef _HYENA_H_
+#define _HYENA_H_
+
+#include <string.h>
+#include <stdlib.h>
+
+#include "gift128.h"
+
+typedef unsigned char u8; 
+typedef unsigned int u32;
+typedef unsigned long long int u64; 
+
+/* 
+ * No. of block cipher rounds to be used
+ */ 
+#define CRYPTO_BC_NUM_ROUNDS (40)
+
+/*
+ * Generate encryption round keys, in the fixsliced representation of
+ * gift128.h.
+ */
+#define _GIFT_ENC_ROUND_KEY_GEN(round_keys, key)		(gift128_keyschedule(round_keys, key))
+
+#endif
@@ -0,0 +1 @@
+../../.templates/Ascon-p/asconp64.c
\ No newline at end of file
@@ -0,0 +1 @@
+../../.templates/Ascon-p/asconp_x4.c
\ No newline at end of file
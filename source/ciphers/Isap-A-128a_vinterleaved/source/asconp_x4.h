@@ -0,0 +1 @@
+../../.templates/Ascon-p/asconp_x4.h
\ No newline at end of file
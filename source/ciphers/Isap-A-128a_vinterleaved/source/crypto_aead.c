@@ -0,0 +1,38 @@
+#include "api.h"
+#include "isap.h"
+#include "crypto_aead.h"
+
+int crypto_aead_encrypt(
+	uint8_t *c, size_t *clen,
+	const uint8_t *m, size_t mlen,
+	const uint8_t *ad, size_t adlen,
+	const uint8_t *npub,
+	const uint8_t *k
+){
+	// Ciphertext length is mlen + tag length
+	*clen = mlen+ISAP_TAG_SZ;
+
+	// Encrypt plaintext
+	if (mlen > 0) {
+		isap_enc(k,npub,m,mlen,c);
+	}
+
+	// Generate tag
+	unsigned char *tag = c+mlen;
+	isap_mac(k,npub,ad,adlen,c,mlen,tag);
+	return 0;
+}
+
+int crypto_aead_decrypt(
+	uint8_t *m, size_t *mlen,
+	const uint8_t *c, size_t clen,
+	const uint8_t *ad, size_t adlen,
+	const uint8_t *npub,
+	const uint8_t *k
+){
+	// Plaintext length is clen - tag length
+	*mlen = clen-ISAP_TAG_SZ;
+
+	// Verify tag, then decrypt
+	return isap_dec(k,npub,ad,adlen,c,*mlen,m);
+}
@@ -0,0 +1,88 @@
+#ifndef ISAP_H
+#define ISAP_H
+
+typedef unsigned char u8;
+typedef unsigned long long u64;
+
+// Rate in bits
+#define ISAP_rH 64
+#define ISAP_rB 1
+
+// Number of rounds
+#define ISAP_sH 12
+#define ISAP_sB 1
+#define ISAP_sE 6
+#define ISAP_sK 12
+
+// State size in bytes
+#define ISAP_STATE_SZ 40
+
+// Size of rate in bytes
+#define ISAP_rH_SZ ((ISAP_rH+7)/8)
+
+// Size of zero truncated IV in bytes
+#define ISAP_IV_SZ 8
+
+// Size of tag in bytes
+#define ISAP_TAG_SZ 16
+
+// Security level
+#define ISAP_K 128
+
+// Maximum number of re-keyings run together by isap_rk_multi()
+#define ISAP_RK_MAX_CHAINS 8
+
+void isap_mac(
+	const unsigned char *k,
+	const unsigned char *npub,
+	const unsigned char *ad, unsigned long long adlen,
+	const unsigned char *c, unsigned long long clen,
+	unsigned char *tag
+);
+
+void isap_rk(
+	const unsigned char *k,
+	const unsigned char *iv,
+	const unsigned char *in,
+	const unsigned long long inlen,
+	unsigned char *out,
+	const unsigned long long outlen
+);
+
+/*
+Runs n independent re-keyings (n at most ISAP_RK_MAX_CHAINS) with inputs of
+the same length, interleaved so that their Ascon rounds, which are serial
+within one re-keying, fill the pipeline; from three re-keyings on, they run
+in AVX2 lanes if the processor supports it.  out[i] may be in[i].
+
+Not used by ISAP itself, which has at most two re-keyings per message; meant
+for batches of messages, and kept in its own object, isap_rk_multi.c.  The
+test folder checks it against isap_rk().
+*/
+void isap_rk_multi(
+	unsigned int n,
+	const unsigned char *const k[],
+	const unsigned char *const iv[],
+	const unsigned char *const in[],
+	const unsigned long long inlen,
+	unsigned char *const out[],
+	const unsigned long long outlen[]
+);
+
+void isap_enc(
+	const unsigned char *k,
+	const unsigned char *npub,
+	const unsigned char *m, unsigned long long mlen,
+	unsigned char *c
+);
+
+// Returns 0 and decrypts c into m if the tag is right, -1 otherwise
+int isap_dec(
+	const unsigned char *k,
+	const unsigned char *npub,
+	const unsigned char *ad, unsigned long long adlen,
+	const unsigned char *c, unsigned long long clen,
+	unsigned char *m
+);
+
+#endif
@@ -0,0 +1,134 @@
+/*
+isap_rk_multi() of ISAP-A-128a, see isap.h.
+
+Written in 2026 by FELICS-AE contributors.
+
+Kept out of isap.c, so that this batch entry point and its AVX2 code are not
+counted in the code size of ISAP, which does not use them.
+*/
+
+#include "api.h"
+#include "isap.h"
+#include "asconp.h"
+#include "rk_chains.h"
+
+#if defined(__x86_64__) && defined(__GNUC__)
+
+#include "asconp_x4.h"
+
+#define ISAP_RK_AVX2 1
+
+// rk_chains() on n chains, 4*g - n of which are dummy copies of chain 0
+static inline __attribute__((always_inline, target("avx2"))) void rk_avx2(
+    const unsigned int n,
+    const int g,
+    const u8 *const k[],
+    const u8 *const iv[],
+    const u8 *const y[],
+    const u64 ylen,
+    u8 *const out[],
+    const u64 outlen[]
+){
+    ascon_state_x4 s[2];
+    __m256i x[2][5];
+    const u8 *yl[8];
+
+    // Init states
+    for (int j = 0; j < 4*g; j++){
+        unsigned int c = (unsigned int)j < n ? (unsigned int)j : 0;
+        s[j/4].x[0][j%4] = ascon_load(k[c]);
+        s[j/4].x[1][j%4] = ascon_load(k[c]+8);
+        s[j/4].x[2][j%4] = ascon_load(iv[c]);
+        s[j/4].x[3][j%4] = s[j/4].x[4][j%4] = 0;
+        yl[j] = y[c];
+    }
+    for (int h = 0; h < g; h++){
+        ascon_permute_x4(&s[h], ISAP_sK);
+        for (int w = 0; w < 5; w++){
+            x[h][w] = _mm256_loadu_si256((const __m256i *)s[h].x[w]);
+        }
+    }
+
+    // Absorb Y, the last bit with P12
+    for (size_t i = 0; i < ylen; i++){
+        __m256i bytes[2];
+        for (int h = 0; h < g; h++){
+            bytes[h] = _mm256_set_epi64x(yl[4*h+3][i], yl[4*h+2][i], yl[4*h+1][i], yl[4*h][i]);
+            bytes[h] = _mm256_slli_epi64(bytes[h], 56);
+        }
+        for (int b = 0; b < 8; b++){
+            for (int h = 0; h < g; h++){
+                __m256i bit = _mm256_slli_epi64(_mm256_srli_epi64(_mm256_slli_epi64(bytes[h], b), 63), 63);
+                x[h][0] = _mm256_xor_si256(x[h][0], bit);
+            }
+            if (i < ylen-1 || b < 7){
+                for (int h = 0; h < g; h++){
+                    ascon_round_x4(x[h], 12-ISAP_sB);
+                }
+            }
+        }
+    }
+    for (int h = 0; h < g; h++){
+        for (int w = 0; w < 5; w++){
+            _mm256_storeu_si256((__m256i *)s[h].x[w], x[h][w]);
+        }
+        ascon_permute_x4(&s[h], ISAP_sK);
+    }
+
+    // Extract K*
+    for (unsigned int j = 0; j < n; j++){
+        ascon_store(out[j],s[j/4].x[0][j%4]);
+        ascon_store(out[j]+8,s[j/4].x[1][j%4]);
+        if(outlen[j] == 24){
+            ascon_store(out[j]+16,s[j/4].x[2][j%4]);
+        }
+    }
+}
+
+__attribute__((target("avx2"))) static void isap_rk_multi_avx2(
+    unsigned int n,
+    const u8 *const k[],
+    const u8 *const iv[],
+    const u8 *const y[],
+    const u64 ylen,
+    u8 *const out[],
+    const u64 outlen[]
+){
+    if (n <= 4)
+        rk_avx2(n, 1, k, iv, y, ylen, out, outlen);
+    else
+        rk_avx2(n, 2, k, iv, y, ylen, out, outlen);
+}
+
+#endif
+
+void isap_rk_multi(
+    unsigned int n,
+    const u8 *const k[],
+    const u8 *const iv[],
+    const u8 *const y[],
+    const u64 ylen,
+    u8 *const out[],
+    const u64 outlen[]
+){
+#ifdef ISAP_RK_AVX2
+    // One AVX2 round costs about as much as two scalar ones
+    if (n >= 3 && __builtin_cpu_supports("avx2")){
+        isap_rk_multi_avx2(n, k, iv, y, ylen, out, outlen);
+        return;
+    }
+#endif
+
+    // Specialized for each n, so that the chains are fully interleaved
+    switch (n){
+    case 1: rk_chains(1, k, iv, y, ylen, out, outlen); break;
+    case 2: rk_chains(2, k, iv, y, ylen, out, outlen); break;
+    case 3: rk_chains(3, k, iv, y, ylen, out, outlen); break;
+    case 4: rk_chains(4, k, iv, y, ylen, out, outlen); break;
+    case 5: rk_chains(5, k, iv, y, ylen, out, outlen); break;
+    case 6: rk_chains(6, k, iv, y, ylen, out, outlen); break;
+    case 7: rk_chains(7, k, iv, y, ylen, out, outlen); break;
+    case 8: rk_chains(8, k, iv, y, ylen, out, outlen); break;
+    }
+}
+
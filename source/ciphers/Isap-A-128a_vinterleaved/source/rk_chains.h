@@ -0,0 +1,80 @@
+/*
+Interleaved re-keyings of ISAP-A-128a.
+
+Written in 2026 by FELICS-AE contributors, from isap_rk() of the 64-bit
+optimized ISAP implementation by Robert Primas.
+
+rk_chains() runs n independent re-keyings with inputs of the same length,
+interleaved so that their Ascon rounds, which are serial within one
+re-keying, fill the pipeline.  It is inlined with a constant n: isap_dec()
+uses it for two chains, isap_rk_multi.c for up to ISAP_RK_MAX_CHAINS.
+*/
+
+#ifndef RK_CHAINS_H
+#define RK_CHAINS_H
+
+#include <stddef.h>
+#include "isap.h"
+#include "asconp.h"
+
+// Round i of Ascon-p[12] on the states x[j] of n chains
+static inline __attribute__((always_inline)) void round_chains(
+    ascon_state x[ISAP_RK_MAX_CHAINS],
+    const unsigned int i,
+    const unsigned int n
+){
+    for (unsigned int j = 0; j < n; j++){
+        ascon_round(&x[j],i);
+    }
+}
+
+static inline __attribute__((always_inline)) void rk_chains(
+    const unsigned int n,
+    const u8 *const k[],
+    const u8 *const iv[],
+    const u8 *const y[],
+    const u64 ylen,
+    u8 *const out[],
+    const u64 outlen[]
+){
+    ascon_state x[ISAP_RK_MAX_CHAINS];
+
+    // Init states
+    for (unsigned int j = 0; j < n; j++){
+        x[j].x[0] = ascon_load(k[j]);
+        x[j].x[1] = ascon_load(k[j]+8);
+        x[j].x[2] = ascon_load(iv[j]);
+        x[j].x[3] = x[j].x[4] = 0;
+    }
+    for (unsigned int r = 12-ISAP_sK; r < 12; r++){
+        round_chains(x, r, n);
+    }
+
+    // Absorb Y, the last bit with P12
+    for (size_t i = 0; i < ylen*8; i++){
+        size_t cur_byte_pos = i/8;
+        size_t cur_bit_pos = 7-(i%8);
+        for (unsigned int j = 0; j < n; j++){
+            u64 cur_bit = (y[j][cur_byte_pos] >> cur_bit_pos) & 0x01;
+            x[j].x[0] ^= ascon_word(1ULL << 63) & (0-cur_bit);
+        }
+        if (i < ylen*8-1){
+            round_chains(x, 12-ISAP_sB, n);
+        }
+    }
+    for (unsigned int r = 12-ISAP_sK; r < 12; r++){
+        round_chains(x, r, n);
+    }
+
+    // Extract K*
+    for (unsigned int j = 0; j < n; j++){
+        ascon_store(out[j],x[j].x[0]);
+        ascon_store(out[j]+8,x[j].x[1]);
+        if(outlen[j] == 24){
+            ascon_store(out[j]+16,x[j].x[2]);
+        }
+    }
+}
+
+
+#endif
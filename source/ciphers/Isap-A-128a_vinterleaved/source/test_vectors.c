@@ -0,0 +1 @@
+../../Isap-A-128a_vref/source/test_vectors.c
\ No newline at end of file
@@ -0,0 +1,77 @@
+/*
+Written in 2026 by FELICS-AE contributors.
+
+Checks every chain of isap_rk_multi(), for 1 to ISAP_RK_MAX_CHAINS chains,
+against isap_rk(): distinct keys, IVs and inputs per chain, inputs of 1 to
+16 bytes, 16- and 24-byte outputs mixed within a batch, and outputs written
+over the inputs.
+*/
+
+#include <stdio.h>
+#include <string.h>
+#include "api.h"
+#include "isap.h"
+
+#define MAX_IN 16
+#define MAX_OUT 24
+
+static unsigned long seed = 1;
+
+static void random_bytes(unsigned char *p, unsigned int len){
+    for (unsigned int i = 0; i < len; i++){
+        seed = seed*6364136223846793005UL + 1442695040888963407UL;
+        p[i] = (unsigned char)(seed >> 56);
+    }
+}
+
+static int test_rk_multi(unsigned int n, unsigned int inlen, int in_place){
+    unsigned char k[ISAP_RK_MAX_CHAINS][CRYPTO_KEYBYTES];
+    unsigned char iv[ISAP_RK_MAX_CHAINS][ISAP_IV_SZ];
+    unsigned char in[ISAP_RK_MAX_CHAINS][MAX_OUT];
+    unsigned char y[ISAP_RK_MAX_CHAINS][MAX_IN];
+    unsigned char out[ISAP_RK_MAX_CHAINS][MAX_OUT];
+    unsigned char expected[MAX_OUT];
+    const unsigned char *kp[ISAP_RK_MAX_CHAINS], *ivp[ISAP_RK_MAX_CHAINS], *inp[ISAP_RK_MAX_CHAINS];
+    unsigned char *outp[ISAP_RK_MAX_CHAINS];
+    unsigned long long outlen[ISAP_RK_MAX_CHAINS];
+    int errors = 0;
+
+    for (unsigned int j = 0; j < n; j++){
+        random_bytes(k[j], CRYPTO_KEYBYTES);
+        random_bytes(iv[j], ISAP_IV_SZ);
+        random_bytes(in[j], inlen);
+        memcpy(y[j], in[j], inlen);
+        kp[j] = k[j];
+        ivp[j] = iv[j];
+        inp[j] = in[j];
+        outp[j] = in_place ? in[j] : out[j];
+        outlen[j] = (j + inlen) % 2 ? 24 : 16;
+    }
+
+    isap_rk_multi(n, kp, ivp, inp, inlen, outp, outlen);
+
+    for (unsigned int j = 0; j < n; j++){
+        isap_rk(k[j], iv[j], y[j], inlen, expected, outlen[j]);
+        if (memcmp(outp[j], expected, outlen[j]) != 0){
+            printf("isap_rk_multi: chain %u of %u differs (inlen %u%s)\n",
+                j, n, inlen, in_place ? ", in place" : "");
+            errors++;
+        }
+    }
+
+    return errors;
+}
+
+int main(void){
+    int errors = 0;
+
+    for (unsigned int n = 1; n <= ISAP_RK_MAX_CHAINS; n++){
+        for (unsigned int inlen = 1; inlen <= MAX_IN; inlen++){
+            errors += test_rk_multi(n, inlen, 0);
+            errors += test_rk_multi(n, inlen, 1);
+        }
+    }
+
+    printf("%s\n", errors ? "WRONG!" : "CORRECT!");
+    return errors != 0;
+}
@@ -1,55 +0,0 @@
-#include "api.h"
-#include "isap.h"
-#include "crypto_aead.h"
-
-int crypto_aead_encrypt(
-	uint8_t *c, size_t *clen,
-	const uint8_t *m, size_t mlen,
-	const uint8_t *ad, size_t adlen,
-	const uint8_t *npub,
-	const uint8_t *k
-){
-	// Ciphertext length is mlen + tag length
-	*clen = mlen+ISAP_TAG_SZ;
-
-	// Encrypt plaintext
-	if (mlen > 0) {
-		isap_enc(k,npub,m,mlen,c);
-	}
-
-	// Generate tag
-	unsigned char *tag = c+mlen;
-	isap_mac(k,npub,ad,adlen,c,mlen,tag);
-	return 0;
-}
-
-int crypto_aead_decrypt(
-	uint8_t *m, size_t *mlen,
-	const uint8_t *c, size_t clen,
-	const uint8_t *ad, size_t adlen,
-	const uint8_t *npub,
-	const uint8_t *k
-){
-	// Plaintext length is clen - tag length
-	*mlen = clen-ISAP_TAG_SZ;
-
-	// Generate tag
-	unsigned char tag[ISAP_TAG_SZ];
-	isap_mac(k,npub,ad,adlen,c,*mlen,tag);
-
-	// Compare tag
-	unsigned long eq_cnt = 0;
-	for(unsigned int i = 0; i < ISAP_TAG_SZ; i++) {
-		eq_cnt += (tag[i] == c[(*mlen)+i]);
-	}
-
-	// Perform decryption if tag is correct
-	if(eq_cnt == (unsigned long)ISAP_TAG_SZ){
-		if (*mlen > 0) {
-			isap_enc(k,npub,c,*mlen,m);
-		}
-		return 0;
-	} else {
-		return -1;
-	}
-}
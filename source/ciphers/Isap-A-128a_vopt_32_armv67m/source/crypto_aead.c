@@ -0,0 +1 @@
+../../Isap-A-128a_vopt_64/source/crypto_aead.c
\ No newline at end of file
@@ -0,0 +1 @@
+../../Isap-A-128a_vopt_64/source/isap.h
\ No newline at end of file
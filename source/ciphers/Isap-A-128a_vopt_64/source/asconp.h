@@ -0,0 +1 @@
+../../.templates/Ascon-p/asconp64.h
\ No newline at end of file
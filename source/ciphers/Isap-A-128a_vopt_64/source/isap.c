@@ -1,4 +1,11 @@
-#include <stdio.h>
+/*
+Based on the 64-bit optimized ISAP implementation by Robert Primas.
+
+Modified in 2026 by FELICS-AE contributors: the permutation and the
+conversions between bytes and state words come from the shared Ascon-p
+backend (asconp.h), so that this file serves every backend.
+*/
+
 #include <string.h>
 #include "api.h"
 #include "isap.h"
@@ -20,37 +27,32 @@ void isap_rk(
 	u8 *out,
 	const u64 outlen
 ){
-    const u64 *k64 = (u64 *)k;
-    const u64 *iv64 = (u64 *)iv;
-    u64 *out64 = (u64 *)out;
-    u64 x0, x1, x2, x3, x4;
-    u64 t0, t1, t2, t3, t4;
+    ascon_state s;
 
     // Init state
-    t0 = t1 = t2 = t3 = t4 = 0;
-    x0 = U64BIG(k64[0]);
-    x1 = U64BIG(k64[1]);
-    x2 = U64BIG(iv64[0]);
-    x3 = x4 = 0;
-    P12;
-
-    // Absorb Y
+    s.x[0] = ascon_load(k);
+    s.x[1] = ascon_load(k+8);
+    s.x[2] = ascon_load(iv);
+    s.x[3] = s.x[4] = 0;
+    ascon_permute(&s,ISAP_sK);
+
+    // Absorb Y, one bit at a time into the most significant bit of the rate
     for (size_t i = 0; i < ylen*8-1; i++){
         size_t cur_byte_pos = i/8;
         size_t cur_bit_pos = 7-(i%8);
-        u8 cur_bit = ((y[cur_byte_pos] >> (cur_bit_pos)) & 0x01) << 7;
-        x0 ^= ((u64)cur_bit) << 56;
-        P1;
+        u64 cur_bit = (y[cur_byte_pos] >> cur_bit_pos) & 0x01;
+        s.x[0] ^= ascon_word(1ULL << 63) & (0-cur_bit);
+        ascon_round(&s,12-ISAP_sB);
     }
-    u8 cur_bit = ((y[ylen-1]) & 0x01) << 7;
-    x0 ^= ((u64)cur_bit) << 56;
-    P12;
+    u64 cur_bit = y[ylen-1] & 0x01;
+    s.x[0] ^= ascon_word(1ULL << 63) & (0-cur_bit);
+    ascon_permute(&s,ISAP_sK);
 
     // Extract K*
-    out64[0] = U64BIG(x0);
-    out64[1] = U64BIG(x1);
+    ascon_store(out,s.x[0]);
+    ascon_store(out+8,s.x[1]);
     if(outlen == 24){
-        out64[2] = U64BIG(x2);
+        ascon_store(out+16,s.x[2]);
     }
 }
 
@@ -65,76 +67,56 @@ void isap_mac(
     const u8 *c, u64 clen,
     u8 *tag
 ){
-    u8 state[ISAP_STATE_SZ];
-    const u64 *npub64 = (u64 *)npub;
-    u64 *state64 = (u64 *)state;
-    u64 x0, x1, x2, x3, x4;
-    u64 t0, t1, t2, t3, t4;
-    t0 = t1 = t2 = t3 = t4 = 0;
+    u8 y[CRYPTO_KEYBYTES];
+    ascon_state s;
 
     // Init state
-    x0 = U64BIG(npub64[0]);
-    x1 = U64BIG(npub64[1]);
-    x2 = U64BIG(((u64 *)ISAP_IV1)[0]);
-    x3 = x4 = 0;
-    P12;
+    s.x[0] = ascon_load(npub);
+    s.x[1] = ascon_load(npub+8);
+    s.x[2] = ascon_load(ISAP_IV1);
+    s.x[3] = s.x[4] = 0;
+    ascon_permute(&s,ISAP_sH);
 
     /* Absorb ad */
-    u64 *ad64 = (u64*)ad;
     while(adlen >= ISAP_rH_SZ){
-        x0 ^= U64BIG(*ad64);
-        P12;
-        ad64++;
+        s.x[0] ^= ascon_load(ad);
+        ascon_permute(&s,ISAP_sH);
+        ad += ISAP_rH_SZ;
         adlen -= ISAP_rH_SZ;
     }
 
     /* Absorb final ad block */
-    u8 *xo = (u8*)&x0;
-    xo[ISAP_rH_SZ-1-adlen] ^= 0x80;
-    while(adlen > 0) {
-        xo[ISAP_rH_SZ-adlen] ^= ((u8*)ad64)[adlen-1];
-        adlen--;
-    }
-    P12;
+    s.x[0] ^= ascon_loadbytes(ad,adlen);
+    s.x[0] ^= ascon_pad(adlen);
+    ascon_permute(&s,ISAP_sH);
 
     // Domain seperation
-    x4 ^= 0x0000000000000001ULL;
+    s.x[4] ^= ascon_word(1);
 
     /* Absorb c */
-    u64 *c64 = (u64*)c;
     while(clen >= ISAP_rH_SZ){
-        x0 ^= U64BIG(*c64);
-        P12;
-        c64++;
+        s.x[0] ^= ascon_load(c);
+        ascon_permute(&s,ISAP_sH);
+        c += ISAP_rH_SZ;
         clen -= ISAP_rH_SZ;
     }
 
     /* Absorb final c block */
-    xo[ISAP_rH_SZ-1-clen] ^= 0x80;
-    while(clen > 0) {
-        xo[ISAP_rH_SZ-clen] ^= ((u8*)c64)[clen-1];
-        clen--;
-    }
-    P12;
+    s.x[0] ^= ascon_loadbytes(c,clen);
+    s.x[0] ^= ascon_pad(clen);
+    ascon_permute(&s,ISAP_sH);
 
     // Derive K*
-    state64[0] = U64BIG(x0);
-    state64[1] = U64BIG(x1);
-    state64[2] = U64BIG(x2);
-    state64[3] = U64BIG(x3);
-    state64[4] = U64BIG(x4);
-    isap_rk(k,ISAP_IV2,(u8 *)state64,CRYPTO_KEYBYTES,(u8 *)state64,CRYPTO_KEYBYTES);
-    x0 = U64BIG(state64[0]);
-    x1 = U64BIG(state64[1]);
-    x2 = U64BIG(state64[2]);
-    x3 = U64BIG(state64[3]);
-    x4 = U64BIG(state64[4]);
+    ascon_store(y,s.x[0]);
+    ascon_store(y+8,s.x[1]);
+    isap_rk(k,ISAP_IV2,y,CRYPTO_KEYBYTES,y,CRYPTO_KEYBYTES);
+    s.x[0] = ascon_load(y);
+    s.x[1] = ascon_load(y+8);
 
     // Squeeze tag
-    P12;
-    unsigned long long *tag64 = (u64 *)tag;
-    tag64[0] = U64BIG(x0);
-    tag64[1] = U64BIG(x1);
+    ascon_permute(&s,ISAP_sH);
+    ascon_store(tag,s.x[0]);
+    ascon_store(tag+8,s.x[1]);
 }
 
 /******************************************************************************/
@@ -148,37 +130,27 @@ void isap_enc(
     u64 mlen,
 	u8 *c
 ){
-    u8 state[ISAP_STATE_SZ];
+    u8 ke[ISAP_STATE_SZ-CRYPTO_NPUBBYTES];
+    ascon_state s;
 
     // Init state
-    u64 *state64 = (u64 *)state;
-    u64 *npub64 = (u64 *)npub;
-    isap_rk(k,ISAP_IV3,npub,CRYPTO_NPUBBYTES,state,ISAP_STATE_SZ-CRYPTO_NPUBBYTES);
-    u64 x0, x1, x2, x3, x4;
-    u64 t0, t1, t2, t3, t4;
-    t0 = t1 = t2 = t3 = t4 = 0;
-    x0 = U64BIG(state64[0]);
-    x1 = U64BIG(state64[1]);
-    x2 = U64BIG(state64[2]);
-    x3 = U64BIG(npub64[0]);
-    x4 = U64BIG(npub64[1]);
-    P6;
+    isap_rk(k,ISAP_IV3,npub,CRYPTO_NPUBBYTES,ke,ISAP_STATE_SZ-CRYPTO_NPUBBYTES);
+    s.x[0] = ascon_load(ke);
+    s.x[1] = ascon_load(ke+8);
+    s.x[2] = ascon_load(ke+16);
+    s.x[3] = ascon_load(npub);
+    s.x[4] = ascon_load(npub+8);
+    ascon_permute(&s,ISAP_sE);
 
     /* Encrypt m */
-    u64 *m64 = (u64 *)m;
-    u64 *c64 = (u64 *)c;
     while(mlen >= ISAP_rH_SZ){
-        *c64 = U64BIG(x0) ^ *m64;
-        P6;
-        m64++;
-        c64++;
+        ascon_store(c,s.x[0] ^ ascon_load(m));
+        ascon_permute(&s,ISAP_sE);
+        m += ISAP_rH_SZ;
+        c += ISAP_rH_SZ;
         mlen -= ISAP_rH_SZ;
     }
 
     /* Encrypt final m block */
-    u8 *xo = (u8*)&x0;
-    while(mlen > 0) {
-        ((u8*)c64)[mlen-1] = xo[ISAP_rH_SZ-mlen] ^ ((u8*)m64)[mlen-1];
-        mlen--;
-    }
+    ascon_storebytes(c,s.x[0] ^ ascon_loadbytes(m,mlen),mlen);
 }
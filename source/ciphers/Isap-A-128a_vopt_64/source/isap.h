@@ -1,6 +1,9 @@
 #ifndef ISAP_H
 #define ISAP_H
 
+typedef unsigned char u8;
+typedef unsigned long long u64;
+
 // Rate in bits
 #define ISAP_rH 64
 #define ISAP_rB 1
@@ -0,0 +1 @@
+../../.templates/TweGIFT-64_vbitsliced/twegift64.c
\ No newline at end of file
@@ -0,0 +1 @@
+../../LOTUS-AEAD-128_vref/source/api.h
\ No newline at end of file
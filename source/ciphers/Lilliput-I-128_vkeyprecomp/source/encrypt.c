@@ -0,0 +1 @@
+../../.templates/Lilliput_vkeyprecomp/i/encrypt.c
\ No newline at end of file
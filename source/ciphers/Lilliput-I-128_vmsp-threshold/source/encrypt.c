@@ -1 +1 @@
-../../.templates/Lilliput_vfelicsref/i/encrypt.c
\ No newline at end of file
+../../.templates/Lilliput_vmsp-threshold/i/encrypt.c
\ No newline at end of file
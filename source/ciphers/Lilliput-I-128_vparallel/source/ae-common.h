@@ -0,0 +1 @@
+../../.templates/Lilliput_vparallel/ae-common.h
\ No newline at end of file
@@ -0,0 +1 @@
+../../.templates/Lilliput_vparallel/cipher.c
\ No newline at end of file
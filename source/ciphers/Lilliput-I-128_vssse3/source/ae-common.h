@@ -0,0 +1 @@
+../../.templates/Lilliput_vssse3/ae-common.h
\ No newline at end of file
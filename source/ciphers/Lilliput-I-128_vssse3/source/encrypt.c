@@ -0,0 +1 @@
+../../.templates/Lilliput_vssse3/i/encrypt.c
\ No newline at end of file
@@ -0,0 +1 @@
+../../.templates/Lilliput_vssse3/sbox-ssse3.h
\ No newline at end of file
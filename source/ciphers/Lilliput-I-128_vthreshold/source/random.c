@@ -0,0 +1 @@
+../../.templates/Lilliput_vthreshold/random.c
\ No newline at end of file
@@ -0,0 +1 @@
+../../.templates/Lilliput_vkeyprecomp/ae-common.h
\ No newline at end of file
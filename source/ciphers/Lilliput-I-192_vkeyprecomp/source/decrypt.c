@@ -0,0 +1 @@
+../../.templates/Lilliput_vkeyprecomp/i/decrypt.c
\ No newline at end of file
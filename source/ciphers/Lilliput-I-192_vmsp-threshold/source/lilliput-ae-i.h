@@ -1 +1 @@
-../../.templates/Lilliput_vfelicsref/i/lilliput-ae-i.h
\ No newline at end of file
+../../.templates/Lilliput_vmsp-threshold/i/lilliput-ae-i.h
\ No newline at end of file
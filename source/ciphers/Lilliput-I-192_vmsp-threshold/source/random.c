@@ -0,0 +1 @@
+../../.templates/Lilliput_vmsp-threshold/random.c
\ No newline at end of file
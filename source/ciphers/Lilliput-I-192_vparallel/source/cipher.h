@@ -0,0 +1 @@
+../../.templates/Lilliput_vparallel/cipher.h
\ No newline at end of file
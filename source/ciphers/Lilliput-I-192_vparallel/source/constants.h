@@ -0,0 +1 @@
+../../.templates/Lilliput_vparallel/constants.h
\ No newline at end of file
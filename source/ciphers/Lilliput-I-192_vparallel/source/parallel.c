@@ -0,0 +1 @@
+../../.templates/Lilliput_vparallel/parallel.c
\ No newline at end of file
@@ -0,0 +1 @@
+../../.templates/Lilliput_vparallel/parallel.h
\ No newline at end of file
@@ -0,0 +1 @@
+../../.templates/Lilliput_vparallel/sbox-ssse3.h
\ No newline at end of file
@@ -0,0 +1 @@
+../../.templates/Lilliput_vssse3/cipher.h
\ No newline at end of file
@@ -0,0 +1 @@
+../../.templates/Lilliput_vssse3/i/decrypt.c
\ No newline at end of file
@@ -0,0 +1 @@
+../../.templates/Lilliput_vkeyprecomp/i/lilliput-ae-i.h
\ No newline at end of file
@@ -0,0 +1 @@
+../../.templates/Lilliput_vkeyprecomp/tweakey.c
\ No newline at end of file
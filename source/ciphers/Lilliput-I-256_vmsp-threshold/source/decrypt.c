@@ -1 +1 @@
-../../.templates/Lilliput_vfelicsref/i/decrypt.c
\ No newline at end of file
+../../.templates/Lilliput_vmsp-threshold/i/decrypt.c
\ No newline at end of file
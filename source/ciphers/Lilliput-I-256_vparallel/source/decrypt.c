@@ -0,0 +1 @@
+../../.templates/Lilliput_vparallel/i/decrypt.c
\ No newline at end of file
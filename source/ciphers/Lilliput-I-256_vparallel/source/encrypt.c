@@ -0,0 +1 @@
+../../.templates/Lilliput_vparallel/i/encrypt.c
\ No newline at end of file
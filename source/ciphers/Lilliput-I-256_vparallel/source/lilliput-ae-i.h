@@ -0,0 +1 @@
+../../.templates/Lilliput_vparallel/i/lilliput-ae-i.h
\ No newline at end of file
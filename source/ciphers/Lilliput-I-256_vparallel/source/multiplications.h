@@ -0,0 +1 @@
+../../.templates/Lilliput_vparallel/multiplications.h
\ No newline at end of file
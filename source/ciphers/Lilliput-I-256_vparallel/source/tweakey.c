@@ -0,0 +1 @@
+../../.templates/Lilliput_vparallel/tweakey.c
\ No newline at end of file
@@ -0,0 +1 @@
+../../.templates/Lilliput_vparallel/tweakey.h
\ No newline at end of file
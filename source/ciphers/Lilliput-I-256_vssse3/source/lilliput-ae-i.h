@@ -0,0 +1 @@
+../../.templates/Lilliput_vssse3/i/lilliput-ae-i.h
\ No newline at end of file
@@ -0,0 +1 @@
+../../Lilliput-I-256_vfelicsref/source/parameters.h
\ No newline at end of file
@@ -0,0 +1 @@
+../../.templates/Lilliput_vkeyprecomp/constants.h
\ No newline at end of file
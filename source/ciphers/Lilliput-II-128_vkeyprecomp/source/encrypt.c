@@ -0,0 +1 @@
+../../.templates/Lilliput_vkeyprecomp/ii/encrypt.c
\ No newline at end of file
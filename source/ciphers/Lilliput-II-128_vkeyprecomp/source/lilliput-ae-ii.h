@@ -0,0 +1 @@
+../../.templates/Lilliput_vkeyprecomp/ii/lilliput-ae-ii.h
\ No newline at end of file
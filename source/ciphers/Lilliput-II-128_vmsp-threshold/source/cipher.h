@@ -1 +1 @@
-../../.templates/Lilliput_vfelicsref/cipher.h
\ No newline at end of file
+../../.templates/Lilliput_vmsp-threshold/cipher.h
\ No newline at end of file
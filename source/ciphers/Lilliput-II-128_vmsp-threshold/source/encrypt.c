@@ -1 +1 @@
-../../.templates/Lilliput_vfelicsref/ii/encrypt.c
\ No newline at end of file
+../../.templates/Lilliput_vmsp-threshold/ii/encrypt.c
\ No newline at end of file
@@ -0,0 +1 @@
+../../.templates/Lilliput_vmsp-threshold/multiplications.h
\ No newline at end of file
@@ -0,0 +1 @@
+../../Lilliput-II-128_vfelicsref/source/parameters.h
\ No newline at end of file
@@ -0,0 +1 @@
+../../Lilliput-II-128_vfelicsref/source/test_vectors.c
\ No newline at end of file
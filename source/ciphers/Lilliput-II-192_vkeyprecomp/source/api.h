@@ -0,0 +1 @@
+../../.templates/Lilliput_vfelicsref/api.h
\ No newline at end of file
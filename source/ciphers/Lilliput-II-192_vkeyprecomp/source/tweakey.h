@@ -0,0 +1 @@
+../../.templates/Lilliput_vkeyprecomp/tweakey.h
\ No newline at end of file
@@ -1 +1 @@
-../../.templates/Lilliput_vfelicsref/constants.h
\ No newline at end of file
+../../.templates/Lilliput_vmsp-threshold/constants.h
\ No newline at end of file
@@ -0,0 +1 @@
+../../.templates/Lilliput_vssse3/ii/lilliput-ae-ii.h
\ No newline at end of file
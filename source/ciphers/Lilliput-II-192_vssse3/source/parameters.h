@@ -0,0 +1 @@
+../../Lilliput-II-192_vfelicsref/source/parameters.h
\ No newline at end of file
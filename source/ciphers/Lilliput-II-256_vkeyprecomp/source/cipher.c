@@ -0,0 +1 @@
+../../.templates/Lilliput_vkeyprecomp/cipher.c
\ No newline at end of file
@@ -0,0 +1 @@
+../../.templates/Lilliput_vkeyprecomp/cipher.h
\ No newline at end of file
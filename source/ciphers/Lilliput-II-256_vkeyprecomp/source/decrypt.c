@@ -0,0 +1 @@
+../../.templates/Lilliput_vkeyprecomp/ii/decrypt.c
\ No newline at end of file
@@ -0,0 +1 @@
+../../Lilliput-II-256_vfelicsref/source/parameters.h
\ No newline at end of file
@@ -1 +1 @@
-../../.templates/Lilliput_vfelicsref/ae-common.h
\ No newline at end of file
+../../.templates/Lilliput_vmsp-threshold/ae-common.h
\ No newline at end of file
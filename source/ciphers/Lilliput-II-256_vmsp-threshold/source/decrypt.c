@@ -1 +1 @@
-../../.templates/Lilliput_vfelicsref/ii/decrypt.c
\ No newline at end of file
+../../.templates/Lilliput_vmsp-threshold/ii/decrypt.c
\ No newline at end of file
@@ -1 +1 @@
-../../.templates/Lilliput_vfelicsref/ii/lilliput-ae-ii.h
\ No newline at end of file
+../../.templates/Lilliput_vmsp-threshold/ii/lilliput-ae-ii.h
\ No newline at end of file
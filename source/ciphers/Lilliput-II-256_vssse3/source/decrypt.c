@@ -0,0 +1 @@
+../../.templates/Lilliput_vssse3/ii/decrypt.c
\ No newline at end of file
@@ -0,0 +1 @@
+../../.templates/Lilliput_vssse3/ii/encrypt.c
\ No newline at end of file
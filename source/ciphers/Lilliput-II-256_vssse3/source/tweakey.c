@@ -0,0 +1 @@
+../../.templates/Lilliput_vssse3/tweakey.c
\ No newline at end of file
@@ -0,0 +1 @@
+../../.templates/Lilliput_vssse3/tweakey.h
\ No newline at end of file
@@ -0,0 +1 @@
+../../PHOTON-Beetle-AEAD128_vref/source/api.h
\ No newline at end of file
@@ -0,0 +1 @@
+../../PHOTON-Beetle-AEAD128_vref/source/beetle.h
\ No newline at end of file
@@ -0,0 +1,144 @@
+/*
+ * Table-based PHOTON-256, see photon.h.
+ *
+ * Column c of the state is a u32 holding the nibble of row r at bits
+ * 4 * r.  After SubCells and ShiftRows, row r of column c is S applied to
+ * row r of column (c + r) % D; MixColumnSerial then multiplies the column
+ * by MixColMatrix, so each input nibble contributes
+ * S(x) * MixColMatrix[.][r] to the output column.  SCMC_TABLE[r][x] is
+ * that contribution, packed like the columns, and a round is 64 lookups.
+ * The round constants of AddKey only touch column 0: RC_COL packs them.
+ *
+ * The tables were computed from the sbox, MixColMatrix and RC of the
+ * reference photon.c.
+ */
+#include "photon.h"
+
+static const u32 RC_COL[ROUND] = {
+	0x9dfe6201, 0xbfdc4023, 0xfb980467, 0x62019dfe,
+	0x5132aecd, 0x3754c8ab, 0xea891576, 0x4023bfdc,
+	0x1576ea89, 0xaecd5132, 0xd9ba2645, 0x2645d9ba,
+};
+
+static const u32 SCMC_TABLE[D][16] = {
+	{
+		0x8f68c5fb, 0x69b6579a, 0x4e346bec, 0x3dc3bad5,
+		0xe6de9261, 0x00000000, 0xc15cae17, 0x73f7d139,
+		0x27823c76, 0x5475ed4f, 0xa8eaf98d, 0x1a4186a3,
+		0x95294358, 0xb2ab7f2e, 0xfc9f14c2, 0xdb1d28b4,
+	},
+	{
+		0xcb4fe565, 0x5a39d7b7, 0x6c2e7b3b, 0xb58dfaca,
+		0x917632d2, 0x00000000, 0xa7619e5e, 0xd9a381f1,
+		0x3617ac8c, 0xefb42d7d, 0xfd5849e9, 0x839a5646,
+		0x48d5b323, 0x7ec21faf, 0x12ec6494, 0x24fbc818,
+	},
+	{
+		0x3b9693ab, 0xca2b2cea, 0x8cd3d85c, 0x651c1675,
+		0xf1bdbf41, 0x00000000, 0xb7454bf7, 0xe9cfce29,
+		0x46f8f4b6, 0xaf373a9f, 0x7d6e671d, 0x23e4e2c3,
+		0x18727168, 0x5e8a85de, 0xd2595d82, 0x94a1a934,
+	},
+	{
+		0x1183c33d, 0x446c5cc1, 0x9948688f, 0x2236b669,
+		0x55ef9ffc, 0x00000000, 0x88cbabb2, 0xbb7edee6,
+		0xdd24344e, 0x665aeaa8, 0xcca7f773, 0xff128227,
+		0xee91411a, 0x33b57554, 0xaafd1ddb, 0x77d92995,
+	},
+	{
+		0x9754f62b, 0x2f739b8a, 0xdab2e31c, 0x1ea8dc45,
+		0xb8276da1, 0x00000000, 0x4de61537, 0xc41a3f59,
+		0xf5c17896, 0x31db47cf, 0x62958ebd, 0xeb69a4d3,
+		0x7c3d52f8, 0x89fc2a6e, 0x534ec972, 0xa68fb1e4,
+	},
+	{
+		0x1cf9352a, 0x4592c78e, 0x96ed8b15, 0x2bd16a47,
+		0x596bf2a4, 0x00000000, 0x8a14be3f, 0xbd3ce152,
+		0xd37f4c9b, 0x6e43adc9, 0xcf8679b1, 0xf8ae26dc,
+		0xe45713f6, 0x37285f6d, 0xa1c5d478, 0x72ba98e3,
+	},
+	{
+		0xbc648399, 0xa5b36c22, 0xc63248dd, 0x5bc83611,
+		0x19d7efbb, 0x00000000, 0x7a56cb44, 0x9dfa7ecc,
+		0x638124ff, 0xfe7b5a33, 0xdfe5a766, 0x384912ee,
+		0x842d9177, 0xe7acb588, 0x219efd55, 0x421fd9aa,
+	},
+	{
+		0x74e346be, 0xf3dc3bad, 0xa27823c7, 0xe8f68c5f,
+		0x873f7d13, 0x00000000, 0xd69b6579, 0x4a8eaf98,
+		0x51a4186a, 0x1b2ab7f2, 0x25475ed4, 0xb9529435,
+		0xcdb1d28b, 0x9c15cae1, 0x3e6de926, 0x6fc9f14c,
+	},
+};
+
+/* Swaps the bits of b selected by mask with the bits of a n positions above */
+#define SWAPMOVE(a, b, mask, n) do {            \
+	u32 tmp_ = ((b) ^ ((a) >> (n))) & (mask);   \
+	(b) ^= tmp_;                                \
+	(a) ^= tmp_ << (n);                         \
+} while (0)
+
+/* Transposes the 8x8 matrix of nibbles w[i] >> (4 * j) (an involution) */
+static void transpose(u32 w[D])
+{
+	int i;
+	for (i = 0; i < D; i += 2) SWAPMOVE(w[i], w[i + 1], 0x0f0f0f0f, 4);
+	for (i = 0; i < D; i++) if (!(i & 2)) SWAPMOVE(w[i], w[i + 2], 0x00ff00ff, 8);
+	for (i = 0; i < D / 2; i++) SWAPMOVE(w[i], w[i + 4], 0x0000ffff, 16);
+}
+
+#define NIB(x, r)	(((x) >> (4 * (r))) & 0xf)
+
+#define SCMC(s, c) (                                  \
+	SCMC_TABLE[0][NIB(s[(c)          ], 0)] ^         \
+	SCMC_TABLE[1][NIB(s[((c) + 1) % D], 1)] ^         \
+	SCMC_TABLE[2][NIB(s[((c) + 2) % D], 2)] ^         \
+	SCMC_TABLE[3][NIB(s[((c) + 3) % D], 3)] ^         \
+	SCMC_TABLE[4][NIB(s[((c) + 4) % D], 4)] ^         \
+	SCMC_TABLE[5][NIB(s[((c) + 5) % D], 5)] ^         \
+	SCMC_TABLE[6][NIB(s[((c) + 6) % D], 6)] ^         \
+	SCMC_TABLE[7][NIB(s[((c) + 7) % D], 7)])
+
+/* AddKey, then SubCells, ShiftRows and MixColumnSerial from s into t */
+static void round_scmc(u32 t[D], u32 s[D], int round)
+{
+	s[0] ^= RC_COL[round];
+	t[0] = SCMC(s, 0);
+	t[1] = SCMC(s, 1);
+	t[2] = SCMC(s, 2);
+	t[3] = SCMC(s, 3);
+	t[4] = SCMC(s, 4);
+	t[5] = SCMC(s, 5);
+	t[6] = SCMC(s, 6);
+	t[7] = SCMC(s, 7);
+}
+
+void PHOTON_Permutation(unsigned char *State_in)
+{
+	u32 s[D], t[D];
+	int i;
+
+	/* rows, as little-endian words, then columns */
+	for (i = 0; i < D; i++)
+	{
+		const unsigned char *p = State_in + 4 * i;
+		s[i] = (u32)p[0] | (u32)p[1] << 8 | (u32)p[2] << 16 | (u32)p[3] << 24;
+	}
+	transpose(s);
+
+	for (i = 0; i < ROUND; i += 2)
+	{
+		round_scmc(t, s, i);
+		round_scmc(s, t, i + 1);
+	}
+
+	transpose(s);
+	for (i = 0; i < D; i++)
+	{
+		unsigned char *p = State_in + 4 * i;
+		p[0] = (unsigned char)s[i];
+		p[1] = (unsigned char)(s[i] >> 8);
+		p[2] = (unsigned char)(s[i] >> 16);
+		p[3] = (unsigned char)(s[i] >> 24);
+	}
+}
@@ -0,0 +1,22 @@
+#ifndef __PHOTON_H_
+#define __PHOTON_H_
+
+#include <stdint.h>
+
+#define ROUND			12
+
+#define D				8
+
+typedef uint8_t	byte;
+typedef uint32_t	u32;
+
+/*
+ * PHOTON-256 on the 32-byte state of beetle.h (nibble i of the state,
+ * row i / D and column i % D, in byte i / 2, low nibble first).
+ *
+ * The state is permuted as D packed columns of D nibbles, with SubCells,
+ * ShiftRows and MixColumnSerial merged into one table lookup per nibble.
+ */
+void PHOTON_Permutation(unsigned char *State_inout);
+
+#endif /*  end of photon.h */
@@ -0,0 +1 @@
+../../PHOTON-Beetle-AEAD128_vref/source/test_vectors.c
\ No newline at end of file
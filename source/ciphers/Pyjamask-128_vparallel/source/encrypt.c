@@ -0,0 +1,345 @@
+/*
+Pyjamask-128-OCB reference code
+Modified by: Siang Meng Sim
+Email: crypto.s.m.sim@gmail.com
+Date : 25/02/2019
+
+Modified in 2026 by FELICS-AE contributors: blocks are kept as the
+big-endian words Pyjamask-128 works on, the key is expanded once per call
+along with a table of the L_i, and the whole blocks of the associated
+data and of the message go through pyjamask_128_enc_blocks /
+pyjamask_128_dec_blocks by groups of up to four.
+*/
+
+/*
+// CAESAR OCB v1 reference code. Info: http://www.cs.ucdavis.edu/~rogaway/ocb
+//
+// ** This version is slow and susceptible to side-channel attacks. **
+// ** Do not use for any purpose other than to understand OCB.      **
+//
+// Written by Ted Krovetz (ted@krovetz.net). Last modified 13 May 2014.
+//
+// Phillip Rogaway holds patents relevant to OCB. See the following for
+// his free patent grant: http://www.cs.ucdavis.edu/~rogaway/ocb/grant.htm
+//
+// This is free and unencumbered software released into the public domain.
+//
+// Anyone is free to copy, modify, publish, use, compile, sell, or
+// distribute this software, either in source code form or as a compiled
+// binary, for any purpose, commercial or non-commercial, and by any
+// means.
+//
+// In jurisdictions that recognize copyright laws, the author or authors
+// of this software dedicate any and all copyright interest in the
+// software to the public domain. We make this dedication for the benefit
+// of the public at large and to the detriment of our heirs and
+// successors. We intend this dedication to be an overt act of
+// relinquishment in perpetuity of all present and future rights to this
+// software under copyright law.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+// OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+// OTHER DEALINGS IN THE SOFTWARE.
+//
+// For more information, please refer to <http://unlicense.org/>
+*/
+
+#include <string.h>
+
+#include "api.h"
+#include "crypto_aead.h"
+#define KEYBYTES   CRYPTO_KEYBYTES
+#define NONCEBYTES CRYPTO_NPUBBYTES
+#define TAGBYTES   CRYPTO_ABYTES
+
+#include "pyjamask.h"
+
+typedef pyjamask_128_state block;
+
+/* blocks encrypted together */
+#define LANES       4
+
+/* L_i for i < L_MAX, enough for 2^L_MAX - 1 blocks */
+#define L_MAX       32
+
+typedef struct {
+    uint32_t rk[PYJAMASK_128_RKEY_WORDS];
+    block lstar, ldollar;
+    block l[L_MAX];
+} ocb_key;
+
+/* ------------------------------------------------------------------------- */
+
+static void load_block(block d, const unsigned char *p) {
+    unsigned i;
+    for (i=0; i<4; i++, p+=4)
+        d[i] = (uint32_t)p[0] << 24 | (uint32_t)p[1] << 16 |
+               (uint32_t)p[2] <<  8 | (uint32_t)p[3];
+}
+
+static void store_block(unsigned char *p, const block s) {
+    unsigned i;
+    for (i=0; i<4; i++, p+=4) {
+        p[0] = (unsigned char)(s[i] >> 24);
+        p[1] = (unsigned char)(s[i] >> 16);
+        p[2] = (unsigned char)(s[i] >>  8);
+        p[3] = (unsigned char)(s[i]);
+    }
+}
+
+/* ------------------------------------------------------------------------- */
+
+static void xor_block(block d, const block s1, const block s2) {
+    unsigned i;
+    for (i=0; i<4; i++)
+        d[i] = s1[i] ^ s2[i];
+}
+
+/* ------------------------------------------------------------------------- */
+
+static void double_block(block d, const block s) {
+    uint32_t tmp = s[0];
+    d[0] = (s[0] << 1) | (s[1] >> 31);
+    d[1] = (s[1] << 1) | (s[2] >> 31);
+    d[2] = (s[2] << 1) | (s[3] >> 31);
+    d[3] = (s[3] << 1) ^ ((tmp >> 31) * 135);
+}
+
+/* ------------------------------------------------------------------------- */
+
+static unsigned ntz(unsigned i) {
+    unsigned n = 0;
+    for ( ; (i&1)==0 ; i>>=1)
+        n++;
+    return n;
+}
+
+/* ------------------------------------------------------------------------- */
+
+/* expand k, and compute L_*, L_$ and the L_i needed for up to maxblocks blocks */
+static void setup_key(ocb_key *key, const unsigned char *k, unsigned maxblocks) {
+    unsigned i;
+
+    pyjamask_128_key_schedule(k, key->rk);
+
+    /* L_* = ENCIPHER(K, zeros(128)) */
+    memset(key->lstar, 0, sizeof(block));
+    pyjamask_128_enc_blocks(&key->lstar, 1, key->rk);
+    /* L_$ = double(L_*) */
+    double_block(key->ldollar, key->lstar);
+    /* L_0 = double(L_$), L_i = double(L_{i-1}) */
+    double_block(key->l[0], key->ldollar);
+    for (i=1; i<L_MAX && (maxblocks >> i) != 0; i++)
+        double_block(key->l[i], key->l[i-1]);
+}
+
+/* ------------------------------------------------------------------------- */
+
+static void hash(block result, const ocb_key *key,
+                 const unsigned char *a, unsigned abytes) {
+    block offset, sum, tmp[LANES];
+    unsigned i, j, n, nblocks = abytes/16;
+    unsigned char buf[16];
+
+    /* Process any whole blocks, LANES at a time */
+
+    /* Sum_0 = zeros(128) */
+    memset(sum, 0, sizeof(block));
+    /* Offset_0 = zeros(128) */
+    memset(offset, 0, sizeof(block));
+    for (i=0; i<nblocks; i+=n) {
+        n = (nblocks-i < LANES) ? nblocks-i : LANES;
+        for (j=0; j<n; j++, a=a+16) {
+            /* Offset_i = Offset_{i-1} xor L_{ntz(i)} */
+            xor_block(offset, offset, key->l[ntz(i+j+1)]);
+            /* tmp = A_i xor Offset_i */
+            load_block(tmp[j], a);
+            xor_block(tmp[j], tmp[j], offset);
+        }
+        /* Sum_i = Sum_{i-1} xor ENCIPHER(K, A_i xor Offset_i) */
+        pyjamask_128_enc_blocks(tmp, n, key->rk);
+        for (j=0; j<n; j++)
+            xor_block(sum, sum, tmp[j]);
+    }
+
+    /* Process any final partial block; compute final hash value */
+
+    abytes = abytes % 16;  /* Bytes in final block */
+    if (abytes > 0) {
+        /* Offset_* = Offset_m xor L_* */
+        xor_block(offset, offset, key->lstar);
+        /* tmp = (A_* || 1 || zeros(127-bitlen(A_*))) xor Offset_* */
+        memset(buf, 0, 16);
+        memcpy(buf, a, abytes);
+        buf[abytes] = 0x80;
+        load_block(tmp[0], buf);
+        xor_block(tmp[0], offset, tmp[0]);
+        /* Sum = Sum_m xor ENCIPHER(K, tmp) */
+        pyjamask_128_enc_blocks(tmp, 1, key->rk);
+        xor_block(sum, tmp[0], sum);
+    }
+
+    memcpy(result, sum, sizeof(block));
+}
+
+/* ------------------------------------------------------------------------- */
+
+static int ocb_crypt(unsigned char *out, const unsigned char *k, const unsigned char *n,
+                     const unsigned char *a, unsigned abytes,
+                     const unsigned char *in, unsigned inbytes, int encrypting) {
+    ocb_key key;
+    block sum, offset, pad, tag, ad_hash, off[LANES], tmp[LANES];
+    unsigned char nonce[16], ktop[16], stretch[24], padbytes[16], buf[16];
+    unsigned bottom, byteshift, bitshift, i, j, nb, nblocks;
+
+    /* Strip ciphertext of its tag */
+    if ( ! encrypting ) {
+         if (inbytes < TAGBYTES) return -1;
+         inbytes -= TAGBYTES;
+    }
+    nblocks = inbytes/16;
+
+    /* Key-dependent variables */
+
+    setup_key(&key, k, (abytes/16 > nblocks) ? abytes/16 : nblocks);
+
+    /* Nonce-dependent and per-encryption variables */
+
+    /* Nonce = zeros(127-bitlen(N)) || 1 || N */
+    memset(nonce,0,16);
+    memcpy(&nonce[16-NONCEBYTES],n,NONCEBYTES);
+    nonce[0] = (unsigned char)(((TAGBYTES * 8) % 128) << 1);
+    nonce[16-NONCEBYTES-1] |= 0x01;
+    /* bottom = str2num(Nonce[123..128]) */
+    bottom = nonce[15] & 0x3F;
+    /* Ktop = ENCIPHER(K, Nonce[1..122] || zeros(6)) */
+    nonce[15] &= 0xC0;
+    load_block(tmp[0], nonce);
+    pyjamask_128_enc_blocks(tmp, 1, key.rk);
+    store_block(ktop, tmp[0]);
+    /* Stretch = Ktop || (Ktop[1..64] xor Ktop[9..72]) */
+    memcpy(stretch, ktop, 16);
+    for (i=0; i<8; i++)
+        stretch[16+i] = ktop[i] ^ ktop[i+1];
+    /* Offset_0 = Stretch[1+bottom..128+bottom] */
+    byteshift = bottom/8;
+    bitshift  = bottom%8;
+    if (bitshift != 0)
+        for (i=0; i<16; i++)
+            buf[i] = (stretch[i+byteshift] << bitshift) |
+                     (stretch[i+byteshift+1] >> (8-bitshift));
+    else
+        for (i=0; i<16; i++)
+            buf[i] = stretch[i+byteshift];
+    load_block(offset, buf);
+    /* Checksum_0 = zeros(128) */
+    memset(sum, 0, sizeof(block));
+
+    /* Hash associated data */
+    hash(ad_hash, &key, a, abytes);
+
+    /* Process any whole blocks, LANES at a time */
+
+    for (i=0; i<nblocks; i+=nb) {
+        nb = (nblocks-i < LANES) ? nblocks-i : LANES;
+        for (j=0; j<nb; j++) {
+            /* Offset_i = Offset_{i-1} xor L_{ntz(i)} */
+            xor_block(offset, offset, key.l[ntz(i+j+1)]);
+            memcpy(off[j], offset, sizeof(block));
+            load_block(tmp[j], in + 16*j);
+            if (encrypting)
+                /* Checksum_i = Checksum_{i-1} xor P_i */
+                xor_block(sum, tmp[j], sum);
+            xor_block(tmp[j], tmp[j], offset);
+        }
+        if (encrypting)
+            /* C_i = Offset_i xor ENCIPHER(K, P_i xor Offset_i) */
+            pyjamask_128_enc_blocks(tmp, nb, key.rk);
+        else
+            /* P_i = Offset_i xor DECIPHER(K, C_i xor Offset_i) */
+            pyjamask_128_dec_blocks(tmp, nb, key.rk);
+        for (j=0; j<nb; j++) {
+            xor_block(tmp[j], off[j], tmp[j]);
+            if ( ! encrypting )
+                /* Checksum_i = Checksum_{i-1} xor P_i */
+                xor_block(sum, tmp[j], sum);
+            store_block(out + 16*j, tmp[j]);
+        }
+        in = in + 16*nb;
+        out = out + 16*nb;
+    }
+
+    /* Process any final partial block and compute raw tag */
+
+    inbytes = inbytes % 16;  /* Bytes in final block */
+    if (inbytes > 0) {
+        /* Offset_* = Offset_m xor L_* */
+        xor_block(offset, offset, key.lstar);
+        /* Pad = ENCIPHER(K, Offset_*) */
+        memcpy(pad, offset, sizeof(block));
+        pyjamask_128_enc_blocks(&pad, 1, key.rk);
+        store_block(padbytes, pad);
+
+        /* buf = P_* || 1 || zeros(127-bitlen(P_*)) */
+        memset(buf, 0, 16);
+        for (i=0; i<inbytes; i++) {
+            /* C_* = P_* xor Pad[1..bitlen(P_*)], and conversely */
+            unsigned char x = in[i] ^ padbytes[i];
+            buf[i] = encrypting ? in[i] : x;
+            out[i] = x;
+        }
+        buf[inbytes] = 0x80;
+        /* Checksum_* = Checksum_m xor (P_* || 1 || zeros(127-bitlen(P_*))) */
+        load_block(tmp[0], buf);
+        xor_block(sum, tmp[0], sum);
+        in = in + inbytes;
+        out = out + inbytes;
+    }
+
+    /* Tag = ENCIPHER(K, Checksum xor Offset xor L_$) xor HASH(K,A) */
+    xor_block(tag, sum, offset);
+    xor_block(tag, tag, key.ldollar);
+    pyjamask_128_enc_blocks(&tag, 1, key.rk);
+    xor_block(tag, ad_hash, tag);
+    store_block(buf, tag);
+
+    if (encrypting) {
+        memcpy(out, buf, TAGBYTES);
+        return 0;
+    } else
+        return (memcmp(in,buf,TAGBYTES) ? -1 : 0);     /* Check for validity */
+}
+
+/* ------------------------------------------------------------------------- */
+
+#define OCB_ENCRYPT 1
+#define OCB_DECRYPT 0
+
+int crypto_aead_encrypt(
+uint8_t *c,size_t *clen,
+const uint8_t *m,size_t mlen,
+const uint8_t *ad,size_t adlen,
+const uint8_t *npub,
+const uint8_t *k
+)
+{
+    *clen = mlen + TAGBYTES;
+    ocb_crypt(c, k, npub, ad, adlen, m, mlen, OCB_ENCRYPT);
+    return 0;
+}
+
+int crypto_aead_decrypt(
+uint8_t *m,size_t *mlen,
+const uint8_t *c,size_t clen,
+const uint8_t *ad,size_t adlen,
+const uint8_t *npub,
+const uint8_t *k
+)
+{
+    *mlen = clen - TAGBYTES;
+    return ocb_crypt(m, k, npub, ad, adlen, c, clen, OCB_DECRYPT);
+}
@@ -0,0 +1,281 @@
+/*
+===============================================================================
+
+    Implementation of Pyjamask-128 in C, on several blocks at once
+
+    Copyright (C) 2019  Dahmun Goudarzi, Jérémy Jean, Stefan Kölbl, 
+    Thomas Peyrin, Matthieu Rivain, Yu Sasaki, Siang Meng Sim
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+    Modified in 2026 by FELICS-AE contributors:
+    - the matrices of mix_rows are circulant, so mat_mult(col, x) is the
+      XOR of the rotations of x by (b+1) % 32 for each bit b of col; these
+      are expanded below for the constant columns;
+    - sub_bytes and mix_rows are applied to 4, 2 or 1 blocks (lanes) at
+      a time, row by row, so that the lanes overlap;
+    - the key schedule is left to the caller.
+
+===============================================================================
+ */
+
+#include <stdint.h>
+
+#include "pyjamask.h"
+
+//==============================================================================
+//=== Parameters
+//==============================================================================
+
+#define NB_ROUNDS_128       14
+
+//==============================================================================
+//=== Macros
+//==============================================================================
+
+#define ROL(x,n)        (((x) << (n)) | ((x) >> (32-(n))))
+
+#define left_rotate(row,n) \
+    row = (row >> n) | (row << (32-n));
+
+// mat_mult(COL_xx, x) of the reference implementation
+#define MUL_M0(x)       ((x) ^ ROL(x, 1) ^ ROL(x, 3) ^ ROL(x, 8) ^ ROL(x,13) ^ ROL(x,18) ^ \
+                         ROL(x,19) ^ ROL(x,24) ^ ROL(x,25) ^ ROL(x,26) ^ ROL(x,30))
+#define MUL_M1(x)       (ROL(x, 1) ^ ROL(x, 6) ^ ROL(x,13) ^ ROL(x,14) ^ ROL(x,15) ^ ROL(x,17) ^ \
+                         ROL(x,23) ^ ROL(x,25) ^ ROL(x,26) ^ ROL(x,30) ^ ROL(x,31))
+#define MUL_M2(x)       (ROL(x, 8) ^ ROL(x,10) ^ ROL(x,13) ^ ROL(x,14) ^ ROL(x,15) ^ ROL(x,16) ^ \
+                         ROL(x,19) ^ ROL(x,20) ^ ROL(x,22) ^ ROL(x,25) ^ ROL(x,28) ^ ROL(x,30) ^ \
+                         ROL(x,31))
+#define MUL_M3(x)       (ROL(x, 1) ^ ROL(x, 2) ^ ROL(x, 5) ^ ROL(x,12) ^ ROL(x,15) ^ ROL(x,17) ^ \
+                         ROL(x,19) ^ ROL(x,22) ^ ROL(x,24) ^ ROL(x,28) ^ ROL(x,31))
+#define MUL_MK(x)       ((x) ^ ROL(x, 2) ^ ROL(x, 4) ^ ROL(x, 7) ^ ROL(x, 8) ^ ROL(x, 9) ^ \
+                         ROL(x,12) ^ ROL(x,13) ^ ROL(x,14) ^ ROL(x,16) ^ ROL(x,17) ^ ROL(x,24) ^ \
+                         ROL(x,28) ^ ROL(x,29) ^ ROL(x,30))
+#define MUL_INV_M0(x)   (ROL(x, 1) ^ ROL(x, 6) ^ ROL(x, 9) ^ ROL(x,14) ^ ROL(x,16) ^ ROL(x,17) ^ \
+                         ROL(x,18) ^ ROL(x,19) ^ ROL(x,21) ^ ROL(x,22) ^ ROL(x,30))
+#define MUL_INV_M1(x)   (ROL(x, 6) ^ ROL(x, 8) ^ ROL(x,10) ^ ROL(x,13) ^ ROL(x,14) ^ ROL(x,15) ^ \
+                         ROL(x,16) ^ ROL(x,17) ^ ROL(x,18) ^ ROL(x,19) ^ ROL(x,20) ^ ROL(x,24) ^ \
+                         ROL(x,29))
+#define MUL_INV_M2(x)   ((x) ^ ROL(x, 7) ^ ROL(x, 8) ^ ROL(x,12) ^ ROL(x,13) ^ ROL(x,15) ^ \
+                         ROL(x,16) ^ ROL(x,19) ^ ROL(x,21) ^ ROL(x,23) ^ ROL(x,29))
+#define MUL_INV_M3(x)   (ROL(x, 1) ^ ROL(x, 2) ^ ROL(x, 3) ^ ROL(x, 5) ^ ROL(x, 9) ^ ROL(x,13) ^ \
+                         ROL(x,14) ^ ROL(x,16) ^ ROL(x,19) ^ ROL(x,21) ^ ROL(x,23) ^ ROL(x,25) ^ \
+                         ROL(x,26) ^ ROL(x,29) ^ ROL(x,30))
+
+//==============================================================================
+//=== Constants
+//==============================================================================
+
+#define KS_CONSTANT_0   0x00000080
+#define KS_CONSTANT_1   0x00006a00
+#define KS_CONSTANT_2   0x003f0000
+#define KS_CONSTANT_3   0x24000000
+
+#define KS_ROT_GAP1      8
+#define KS_ROT_GAP2     15
+#define KS_ROT_GAP3     18
+
+//==============================================================================
+//=== Key schedule
+//==============================================================================
+
+void pyjamask_128_key_schedule(const uint8_t *key, uint32_t *round_keys)
+{
+    int i, r;
+    uint32_t *ks_state = round_keys;
+
+    for (i=0; i<4; i++)
+        ks_state[i] = (uint32_t)key[4*i+0] << 24 | (uint32_t)key[4*i+1] << 16 |
+                      (uint32_t)key[4*i+2] <<  8 | (uint32_t)key[4*i+3];
+
+    for (r=0; r<NB_ROUNDS_KS; r++)
+    {
+        uint32_t tmp = ks_state[0] ^ ks_state[1] ^ ks_state[2] ^ ks_state[3];
+        uint32_t k0 = ks_state[0] ^ tmp;
+
+        ks_state += 4;
+
+        // ks_mix_comlumns, ks_mix_rotate_rows and ks_add_constant
+        ks_state[0] = MUL_MK(k0) ^ KS_CONSTANT_0 ^ r;
+        ks_state[1] = ks_state[-3] ^ tmp;
+        ks_state[2] = ks_state[-2] ^ tmp;
+        ks_state[3] = ks_state[-1] ^ tmp;
+        left_rotate(ks_state[1],KS_ROT_GAP1)
+        left_rotate(ks_state[2],KS_ROT_GAP2)
+        left_rotate(ks_state[3],KS_ROT_GAP3)
+        ks_state[1] ^= KS_CONSTANT_1;
+        ks_state[2] ^= KS_CONSTANT_2;
+        ks_state[3] ^= KS_CONSTANT_3;
+    }
+}
+
+//==============================================================================
+//=== Pyjamask-128 on n lanes
+//==============================================================================
+
+/*
+  s0[j], ..., s3[j] are the rows of lane j; n is a constant at every call,
+  so that the lane loops unroll.
+*/
+
+static inline void sub_bytes_lanes(uint32_t *s0, uint32_t *s1, uint32_t *s2, uint32_t *s3, int n)
+{
+    int j;
+
+    for (j=0; j<n; j++)
+    {
+        uint32_t t;
+
+        s0[j] ^= s3[j];
+        s3[j] ^= s0[j] & s1[j];
+        s0[j] ^= s1[j] & s2[j];
+        s1[j] ^= s2[j] & s3[j];
+        s2[j] ^= s0[j] & s3[j];
+        s2[j] ^= s1[j];
+        s1[j] ^= s0[j];
+        s3[j] = ~s3[j];
+
+        // swap s2 <-> s3
+        t = s2[j]; s2[j] = s3[j]; s3[j] = t;
+    }
+}
+
+static inline void inv_sub_bytes_lanes(uint32_t *s0, uint32_t *s1, uint32_t *s2, uint32_t *s3, int n)
+{
+    int j;
+
+    for (j=0; j<n; j++)
+    {
+        uint32_t t;
+
+        // swap s2 <-> s3
+        t = s2[j]; s2[j] = s3[j]; s3[j] = t;
+
+        s3[j] = ~s3[j];
+        s1[j] ^= s0[j];
+        s2[j] ^= s1[j];
+        s2[j] ^= s3[j] & s0[j];
+        s1[j] ^= s2[j] & s3[j];
+        s0[j] ^= s1[j] & s2[j];
+        s3[j] ^= s0[j] & s1[j];
+        s0[j] ^= s3[j];
+    }
+}
+
+static inline void add_round_key_lanes(uint32_t *s0, uint32_t *s1, uint32_t *s2, uint32_t *s3, int n, const uint32_t *rk)
+{
+    int j;
+
+    for (j=0; j<n; j++)
+    {
+        s0[j] ^= rk[0];
+        s1[j] ^= rk[1];
+        s2[j] ^= rk[2];
+        s3[j] ^= rk[3];
+    }
+}
+
+static inline void enc_lanes(pyjamask_128_state *blocks, int n, const uint32_t *round_keys)
+{
+    uint32_t s0[4], s1[4], s2[4], s3[4];
+    int j, r;
+
+    for (j=0; j<n; j++)
+    {
+        s0[j] = blocks[j][0];
+        s1[j] = blocks[j][1];
+        s2[j] = blocks[j][2];
+        s3[j] = blocks[j][3];
+    }
+
+    for (r=0; r<NB_ROUNDS_128; r++)
+    {
+        add_round_key_lanes(s0, s1, s2, s3, n, round_keys + 4*r);
+        sub_bytes_lanes(s0, s1, s2, s3, n);
+
+        // mix_rows
+        for (j=0; j<n; j++) s0[j] = MUL_M0(s0[j]);
+        for (j=0; j<n; j++) s1[j] = MUL_M1(s1[j]);
+        for (j=0; j<n; j++) s2[j] = MUL_M2(s2[j]);
+        for (j=0; j<n; j++) s3[j] = MUL_M3(s3[j]);
+    }
+
+    add_round_key_lanes(s0, s1, s2, s3, n, round_keys + 4*NB_ROUNDS_128);
+
+    for (j=0; j<n; j++)
+    {
+        blocks[j][0] = s0[j];
+        blocks[j][1] = s1[j];
+        blocks[j][2] = s2[j];
+        blocks[j][3] = s3[j];
+    }
+}
+
+static inline void dec_lanes(pyjamask_128_state *blocks, int n, const uint32_t *round_keys)
+{
+    uint32_t s0[4], s1[4], s2[4], s3[4];
+    int j, r;
+
+    for (j=0; j<n; j++)
+    {
+        s0[j] = blocks[j][0];
+        s1[j] = blocks[j][1];
+        s2[j] = blocks[j][2];
+        s3[j] = blocks[j][3];
+    }
+
+    add_round_key_lanes(s0, s1, s2, s3, n, round_keys + 4*NB_ROUNDS_128);
+
+    for (r=NB_ROUNDS_128-1; r>=0; r--)
+    {
+        // inv_mix_rows
+        for (j=0; j<n; j++) s0[j] = MUL_INV_M0(s0[j]);
+        for (j=0; j<n; j++) s1[j] = MUL_INV_M1(s1[j]);
+        for (j=0; j<n; j++) s2[j] = MUL_INV_M2(s2[j]);
+        for (j=0; j<n; j++) s3[j] = MUL_INV_M3(s3[j]);
+
+        inv_sub_bytes_lanes(s0, s1, s2, s3, n);
+        add_round_key_lanes(s0, s1, s2, s3, n, round_keys + 4*r);
+    }
+
+    for (j=0; j<n; j++)
+    {
+        blocks[j][0] = s0[j];
+        blocks[j][1] = s1[j];
+        blocks[j][2] = s2[j];
+        blocks[j][3] = s3[j];
+    }
+}
+
+static void enc_x4(pyjamask_128_state *blocks, const uint32_t *round_keys) { enc_lanes(blocks, 4, round_keys); }
+static void enc_x2(pyjamask_128_state *blocks, const uint32_t *round_keys) { enc_lanes(blocks, 2, round_keys); }
+static void enc_x1(pyjamask_128_state *blocks, const uint32_t *round_keys) { enc_lanes(blocks, 1, round_keys); }
+
+static void dec_x4(pyjamask_128_state *blocks, const uint32_t *round_keys) { dec_lanes(blocks, 4, round_keys); }
+static void dec_x2(pyjamask_128_state *blocks, const uint32_t *round_keys) { dec_lanes(blocks, 2, round_keys); }
+static void dec_x1(pyjamask_128_state *blocks, const uint32_t *round_keys) { dec_lanes(blocks, 1, round_keys); }
+
+void pyjamask_128_enc_blocks(pyjamask_128_state *blocks, unsigned nblocks, const uint32_t *round_keys)
+{
+    for ( ; nblocks >= 4; nblocks -= 4, blocks += 4) enc_x4(blocks, round_keys);
+    if (nblocks >= 2) { enc_x2(blocks, round_keys); nblocks -= 2; blocks += 2; }
+    if (nblocks) enc_x1(blocks, round_keys);
+}
+
+void pyjamask_128_dec_blocks(pyjamask_128_state *blocks, unsigned nblocks, const uint32_t *round_keys)
+{
+    for ( ; nblocks >= 4; nblocks -= 4, blocks += 4) dec_x4(blocks, round_keys);
+    if (nblocks >= 2) { dec_x2(blocks, round_keys); nblocks -= 2; blocks += 2; }
+    if (nblocks) dec_x1(blocks, round_keys);
+}
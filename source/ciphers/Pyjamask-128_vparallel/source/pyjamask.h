@@ -0,0 +1,49 @@
+/*
+===============================================================================
+
+    Header file for Pyjamsk block ciphers in C
+
+    Copyright (C) 2019  Dahmun Goudarzi, Jérémy Jean, Stefan Kölbl, 
+    Thomas Peyrin, Matthieu Rivain, Yu Sasaki, Siang Meng Sim
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+    Modified in 2026 by FELICS-AE contributors: Pyjamask-128 only, with
+    the key schedule split from the block functions, which work on the
+    state words and on several blocks at once.
+
+===============================================================================
+ */
+
+#ifndef PYJAMASK_H
+#define PYJAMASK_H
+
+#include <stdint.h>
+
+#define NB_ROUNDS_KS        14
+
+// words of the expanded key
+#define PYJAMASK_128_RKEY_WORDS     (4*(NB_ROUNDS_KS+1))
+
+// a block as Pyjamask-128 loads it: four big-endian rows
+typedef uint32_t pyjamask_128_state[4];
+
+void pyjamask_128_key_schedule(const unsigned char *key, uint32_t *round_keys);
+
+// encrypt (decrypt) nblocks blocks in place; groups of four, then two
+// blocks go through the rounds together
+void pyjamask_128_enc_blocks(pyjamask_128_state *blocks, unsigned nblocks, const uint32_t *round_keys);
+void pyjamask_128_dec_blocks(pyjamask_128_state *blocks, unsigned nblocks, const uint32_t *round_keys);
+
+#endif /* PYJAMASK_H */
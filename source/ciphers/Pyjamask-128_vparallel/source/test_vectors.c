@@ -0,0 +1 @@
+../../Pyjamask-128_vref/source/test_vectors.c
\ No newline at end of file
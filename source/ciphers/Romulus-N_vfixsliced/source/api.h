@@ -0,0 +1 @@
+../../Romulus-N_vref/source/api.h
\ No newline at end of file
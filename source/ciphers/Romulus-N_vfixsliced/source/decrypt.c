@@ -0,0 +1 @@
+../../Romulus-N_vref/source/decrypt.c
\ No newline at end of file
@@ -0,0 +1 @@
+../../Romulus-N_vref/source/encrypt.c
\ No newline at end of file
@@ -0,0 +1 @@
+../../Romulus-N_vref/source/romulus_n.h
\ No newline at end of file
@@ -0,0 +1,367 @@
+/*
+ * Date: 05 May 2021
+ * Contact: Romulus Team (Mustafa Khairallah - mustafa.khairallah@ntu.edu.sg)
+ * Romulus-N as compliant with the Romulus v1.3 specifications.
+ * This file icludes the functions of Romulus-N
+ * It superseeds earlier versions developed by Mustafa Khairallah and maintained
+ * by Mustafa Khairallah, Thomas Peyrin and Kazuhiko Minematsu
+ *
+ * Modified in 2026 by FELICS-AE contributors to run on the fixsliced
+ * SKINNY-128-384+: the key part of the tweakey schedule is computed once,
+ * the nonce (or AD block) part once per nonce (or AD block), the domain
+ * part whenever the domain changes, and the counter part is updated in
+ * place for every block.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "api.h"
+#include "variant.h"
+#include "skinny.h"
+#include "romulus_n.h"
+
+// Round tweakeys: TK1 for the current block, its counter and its domain
+// parts, the domain they were computed for, TK3 alone, TK2 and TK3.
+typedef struct {
+  uint32_t rtk1[SKINNY_RTK1_WORDS];
+  uint32_t cnt[SKINNY_RTK1_WORDS];
+  uint32_t domain[SKINNY_RTK1_WORDS];
+  unsigned char D;
+  uint32_t rtk3[SKINNY_RTK_WORDS];
+  uint32_t rtk23[SKINNY_RTK_WORDS];
+} romulus_schedule;
+
+// Padding function: pads the byte length of the message mod 16 to the last incomplete block.
+// For complete blocks it returns the same block.
+static void pad (const unsigned char* m, unsigned char* mp, int l, int len8) {
+  int i;
+
+  for (i = 0; i < l; i++) {
+    if (i < len8) {
+      mp[i] = m[i];
+    }
+    else if (i == l - 1) {
+      mp[i] = (len8 & 0x0f);
+    }
+    else {
+      mp[i] = 0x00;
+    }
+  }
+
+}
+
+// G(S): generates the key stream from the internal state by multiplying the state S by the constant matrix G
+static void g8A (unsigned char* s, unsigned char* c) {
+  int i;
+
+  for (i = 0; i < 16; i++) {
+    c[i] = (s[i] >> 1) ^ (s[i] & 0x80) ^ ((s[i] & 0x01) << 7);
+  }
+
+}
+
+// Rho(S,A) pads an A block and XORs it to the internal state.
+static void rho_ad (const unsigned char* m,
+		    unsigned char* s,
+		    int len8,
+		    int ver) {
+  int i;
+  unsigned char mp [16];
+
+
+  pad(m,mp,ver,len8);
+  for (i = 0; i < ver; i++) {
+    s[i] = s[i] ^ mp[i];
+  }
+
+}
+
+// Rho(S,M): pads an M block and outputs S'= M xor S and C = M xor G(S)
+static void rho (const unsigned char* m,
+		 unsigned char* c,
+		 unsigned char* s,
+		 int len8,
+		 int ver) {
+  int i;
+  unsigned char mp [16];
+
+  pad(m,mp,ver,len8);
+
+  g8A(s,c);
+  for (i = 0; i < ver; i++) {
+    s[i] = s[i] ^ mp[i];
+    if (i < len8) {
+      c[i] = c[i] ^ mp[i];
+    }
+    else {
+      c[i] = 0;
+    }
+  }
+
+}
+
+// Inverse-Rho(S,M): pads a C block and outputs S'= C xor G(S) xor S and M = C xor G(S)
+static void irho (unsigned char* m,
+		  const unsigned char* c,
+		  unsigned char* s,
+		  int len8,
+		  int ver) {
+  int i;
+  unsigned char cp [16];
+
+  pad(c,cp,ver,len8);
+
+  g8A(s,m);
+  for (i = 0; i < ver; i++) {
+    if (i < len8) {
+      s[i] = s[i] ^ cp[i] ^ m[i];
+    }
+    else {
+      s[i] = s[i] ^ cp[i];
+    }
+    if (i < len8) {
+      m[i] = m[i] ^ cp[i];
+    }
+    else {
+      m[i] = 0;
+    }
+  }
+
+}
+
+// Resets the value of the counter, held as its round tweakeys.
+static void reset_lfsr_gf56 (uint32_t* CNT) {
+  static const unsigned char one[8] = {0x01};
+
+  skinny_tk1_schedule(CNT, one);
+}
+
+// Applies CNT'=2 * CNT (mod GF(2^56)), where GF(2^56) is defined using the irreducible polynomial
+// x^56 + x^7 + x^4 + x^2 + 1
+static void lfsr_gf56 (uint32_t* CNT) {
+  skinny_tk1_double(CNT);
+}
+
+// An interface between Romulus and the underlying TBC: the TK1 round tweakeys
+// are the sum of those of the counter and of the domain, the TK2 and TK3 part
+// is taken from the precomputed round tweakeys.
+static void block_cipher(unsigned char* s,
+			 romulus_schedule* schedule,
+			 unsigned char D) {
+  unsigned char TK1 [8] = {0};
+  int i;
+
+  if (D != schedule->D) {
+    TK1[7] = D;
+    skinny_tk1_schedule(schedule->domain, TK1);
+    schedule->D = D;
+  }
+
+  for (i = 0; i < SKINNY_RTK1_WORDS; i++) {
+    schedule->rtk1[i] = schedule->cnt[i] ^ schedule->domain[i];
+  }
+  skinny_128_384_plus_enc(s, schedule->rtk1, schedule->rtk23);
+
+}
+
+// Generates the tag T from the final state S by applying T=G(S).
+static void generate_tag (unsigned char** c, unsigned char* s,
+			  int n, size_t* clen) {
+
+  g8A(s, *c);
+  *c = *c + n;
+  *c = *c - *clen;
+
+}
+
+// Absorbs and encrypts the message blocks; schedule holds the nonce
+// round tweakeys.
+static size_t msg_encryption (const unsigned char** M, unsigned char** c,
+			      unsigned char*s, romulus_schedule* schedule,
+			      unsigned int n, unsigned char D,
+			      size_t mlen, char d) {
+  int len8;
+
+
+  if (mlen >= n) {
+    len8 = n;
+    mlen = mlen - n;
+  }
+  else {
+    len8 = mlen;
+    mlen = 0;
+  }
+  if (d == 0) {
+    rho(*M, *c, s, len8, n);
+  }
+  else {
+    irho(*c, *M, s, len8, n);
+  }
+  *c = *c + len8;
+  *M = *M + len8;
+  lfsr_gf56(schedule->cnt);
+  block_cipher(s,schedule,D);
+  return mlen;
+}
+
+// Absorbs the AD blocks; even blocks are folded into the TK3 round tweakeys.
+static size_t ad_encryption (const unsigned char** A, unsigned char* s,
+			     romulus_schedule* schedule, size_t adlen,
+			     unsigned char D,
+			     unsigned int n, unsigned int t) {
+
+  unsigned char T [16];
+  int len8;
+
+  if (adlen >= n) {
+    len8 = n;
+    adlen = adlen - n;
+  }
+  else {
+    len8 = adlen;
+    adlen = 0;
+  }
+  rho_ad(*A, s, len8, n);
+  *A = *A + len8;
+  lfsr_gf56(schedule->cnt);
+
+  if (adlen != 0) {
+    if (adlen >= t) {
+      len8 = t;
+      adlen = adlen - t;
+    }
+    else {
+      len8 = adlen;
+      adlen = 0;
+    }
+    pad(*A, T, t, len8);
+    *A = *A + len8;
+    skinny_tk2_schedule(schedule->rtk23, schedule->rtk3, T);
+    block_cipher(s,schedule,D);
+    lfsr_gf56(schedule->cnt);
+  }
+
+  return adlen;
+}
+
+static int romulus_n (
+		      unsigned char* c, size_t* clen,
+		      const unsigned char* m, size_t mlen,
+		      const unsigned char* ad, size_t adlen,
+		      const unsigned char* npub,
+		      const unsigned char* k,
+		      char d
+		      )
+{
+  romulus_schedule schedule;
+  unsigned char s[16];
+  unsigned char T[16];
+  unsigned char D;
+  const unsigned char* A;
+  const unsigned char* I;
+  unsigned int n, t, i;
+
+  A = ad;
+  I = m;
+
+  n = AD_BLK_LEN_ODD;
+  t = AD_BLK_LEN_EVN;
+
+  for (i = 0; i < n; i++) {
+    s[i] = 0;
+  }
+  reset_lfsr_gf56(schedule.cnt);
+  schedule.D = 0;
+  for (i = 0; i < SKINNY_RTK1_WORDS; i++) {
+    schedule.domain[i] = 0;
+  }
+  skinny_tk3_schedule(schedule.rtk3, k);
+
+  if (adlen == 0) { // AD is an empty string
+    lfsr_gf56(schedule.cnt);
+    D = 0x1a;
+  }
+  else {
+    while (adlen > (n+t)) { // A normal full pair of blocks of AD
+      adlen = ad_encryption(&A,s,&schedule,adlen,0x08,n,t);
+    }
+    if (adlen == n || adlen == (n+t)) { // The last block of AD is complete
+      D = 0x18;
+    }
+    else { // The last block of AD is incomplete
+      D = 0x1a;
+    }
+    adlen = ad_encryption(&A,s,&schedule,adlen,0x08,n,t);
+  }
+
+  // From now on, TK2 always holds the nonce.
+  skinny_tk2_schedule(schedule.rtk23, schedule.rtk3, npub);
+  block_cipher(s,&schedule,D);
+
+  reset_lfsr_gf56(schedule.cnt);
+
+  n = MSG_BLK_LEN;
+  if (d == 0) {
+    *clen = mlen + CRYPTO_ABYTES;
+  }
+  else {
+    mlen = mlen - CRYPTO_ABYTES;
+    *clen = mlen;
+  }
+
+  if (mlen == 0) { // M is an empty string
+    lfsr_gf56(schedule.cnt);
+    block_cipher(s,&schedule,0x15);
+  }
+  else while (mlen > 0) {
+    if (mlen < n) { // The last block of M is incomplete
+      mlen = msg_encryption(&I,&c,s,&schedule,n,0x15,mlen,d);
+    }
+    else if (mlen == n) { // The last block of M is complete
+      mlen = msg_encryption(&I,&c,s,&schedule,n,0x14,mlen,d);
+    }
+    else { // A normal full message block
+      mlen = msg_encryption(&I,&c,s,&schedule,n,0x04,mlen,d);
+    }
+  }
+
+  // Tag generation
+
+  if (d == 1) {
+    // Tag verification
+    g8A(s, T);
+    for (i = 0; i < 16; i++) {
+      if (T[i] != (*(I+i))) {
+	return -1;
+      }
+    }
+  }
+  else {
+    generate_tag(&c,s,n,clen);
+  }
+
+  return 0;
+}
+
+int romulus_n_encrypt (
+			 unsigned char* c, size_t* clen,
+			 const unsigned char* m, size_t mlen,
+			 const unsigned char* ad, size_t adlen,
+			 const unsigned char* npub,
+			 const unsigned char* k
+			 )
+{
+  return romulus_n(c,clen,m,mlen,ad,adlen,npub,k,0);
+}
+
+int romulus_n_decrypt(
+unsigned char *m,size_t *mlen,
+const unsigned char *c,size_t clen,
+const unsigned char *ad,size_t adlen,
+const unsigned char *npub,
+const unsigned char *k
+)
+{
+  return romulus_n(m,mlen,c,clen,ad,adlen,npub,k,1);
+}
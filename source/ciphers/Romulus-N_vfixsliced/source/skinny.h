@@ -0,0 +1,48 @@
+/*
+ * Fixsliced SKINNY-128-384+ for Romulus-N.
+ *
+ * The state is held in four 32-bit words, each of which holds two of the
+ * eight bit-slices of the 16 cells; see skinny_fixsliced.c for the layout.
+ *
+ * Round tweakeys are computed ahead of time, already in that layout:
+ *
+ * - TK1 (counter and domain) has no LFSR, so its round tweakeys repeat
+ *   every SKINNY_TK1_ROUNDS rounds; only its top 8 cells are ever nonzero,
+ *   so only even rounds get a TK1 round tweakey.  The counter ones are
+ *   updated in place from one block to the next, without unpacking them,
+ * - TK3 (key) and the round constants are computed once per key,
+ * - TK2 (nonce or AD block) is folded into the TK3 round tweakeys once
+ *   per nonce, or once per AD block.
+ */
+
+#ifndef SKINNY_H
+#define SKINNY_H
+
+#include <stdint.h>
+
+#define SKINNY_ROUNDS 40
+#define SKINNY_TK1_ROUNDS 16
+
+#define SKINNY_RTK_WORDS (4*SKINNY_ROUNDS)
+#define SKINNY_RTK1_WORDS (2*SKINNY_TK1_ROUNDS)
+
+/* The bottom 8 cells of TK1 are zero. */
+void skinny_tk1_schedule(uint32_t rtk1[SKINNY_RTK1_WORDS],
+                         const uint8_t tk1[8]);
+
+/* Multiplies the 56-bit counter held in cells 0 to 6 by 2 in GF(2^56), as
+ * Romulus does, directly on its round tweakeys; cell 7 must be zero. */
+void skinny_tk1_double(uint32_t rtk1[SKINNY_RTK1_WORDS]);
+
+void skinny_tk3_schedule(uint32_t rtk3[SKINNY_RTK_WORDS],
+                         const uint8_t tk3[16]);
+
+void skinny_tk2_schedule(uint32_t rtk23[SKINNY_RTK_WORDS],
+                         const uint32_t rtk3[SKINNY_RTK_WORDS],
+                         const uint8_t tk2[16]);
+
+void skinny_128_384_plus_enc(uint8_t block[16],
+                             const uint32_t rtk1[SKINNY_RTK1_WORDS],
+                             const uint32_t rtk23[SKINNY_RTK_WORDS]);
+
+#endif /* SKINNY_H */
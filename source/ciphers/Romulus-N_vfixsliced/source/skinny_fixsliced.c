@@ -0,0 +1,414 @@
+/*
+ * Fixsliced SKINNY-128-384+ for Romulus-N.
+ *
+ * Bit-slice layout: bit b of the cell on row r, column c lives at bit
+ * 8*c + r + 4*(b>>2) of a word; words 0 to 3 hold bits {0,4}, {3,7}, {2,6}
+ * and {1,5}.  Every word thus holds one byte per column and, within each
+ * byte, one bit per row in each nibble.
+ *
+ * SubCells is computed with the decomposition of the 8-bit S-box into four
+ * steps x4 ^= ~(x7|x6), x0 ^= ~(x3|x2) interleaved with bit permutations.
+ * Since each word holds two slices, a step is three word operations; the
+ * bit permutations are carried out with SWAPMOVEs between nibbles, after
+ * which the slices of words {0,1} and {2,3} have been swapped.
+ *
+ * ShiftRows and the row rotation of MixColumns are never carried out:
+ * MixColumns is computed with rotations that align the rows wherever they
+ * currently are.  The rows get back in place every 4 rounds, up to a
+ * rotation of the columns which is undone every 8 rounds, so the round
+ * function comes in 4 flavours and the round tweakeys are computed in the
+ * layout of their round (RTK_CELLS).
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include "skinny.h"
+
+
+#define ROR(x, n) (((x) >> (n)) | ((x) << (32-(n))))
+
+#define SWAPMOVE(a, b, mask, n)                         \
+    do {                                                \
+        uint32_t tmp = ((b) ^ ((a) >> (n))) & (mask);   \
+        (b) ^= tmp;                                     \
+        (a) ^= tmp << (n);                              \
+    } while (0)
+
+#define SBOX(a, b, c, d)                                \
+    do {                                                \
+        (a) ^= ~((b) | (c));                            \
+        SWAPMOVE(a, d, 0x0f0f0f0f, 4);                  \
+        SWAPMOVE(d, c, 0x0f0f0f0f, 4);                  \
+        (c) ^= ~((d) | (a));                            \
+        SWAPMOVE(b, a, 0x0f0f0f0f, 4);                  \
+        SWAPMOVE(c, b, 0x0f0f0f0f, 4);                  \
+        (a) ^= ~((b) | (c));                            \
+        SWAPMOVE(a, d, 0x0f0f0f0f, 4);                  \
+        SWAPMOVE(d, c, 0x0f0f0f0f, 4);                  \
+        (c) ^= ~((d) | (a));                            \
+        SWAPMOVE(a, b, 0x0f0f0f0f, 0);                  \
+    } while (0)
+
+/* Rows 1 ^= 2, 2 ^= 0, 3 ^= 2: each row is selected with a mask and
+ * rotated onto the row it is added to. */
+#define MIXCOLUMNS(x, m0, r0, m1, r1, m2, r2)           \
+    do {                                                \
+        (x) ^= ROR((x) & (m0), r0);                     \
+        (x) ^= ROR((x) & (m1), r1);                     \
+        (x) ^= ROR((x) & (m2), r2);                     \
+    } while (0)
+
+#define ROW0 0x11111111
+#define ROW1 0x22222222
+#define ROW2 0x44444444
+#define ROW3 0x88888888
+
+#define ADD_KEY(s0, s1, s2, s3, rtk)                    \
+    do {                                                \
+        (s0) ^= (rtk)[0];                               \
+        (s1) ^= (rtk)[1];                               \
+        (s2) ^= (rtk)[2];                               \
+        (s3) ^= (rtk)[3];                               \
+    } while (0)
+
+/* Even rounds take the TK1 round tweakey as well, odd rounds do not. */
+#define ROUND_TK1(s0, s1, s2, s3, rtk1, rtk23, m0, r0, m1, r1, m2, r2) \
+    do {                                                \
+        SBOX(s0, s1, s2, s3);                           \
+        ADD_KEY(s0, s1, s2, s3, rtk1);                  \
+        ADD_KEY(s0, s1, s2, s3, rtk23);                 \
+        MIXCOLUMNS(s0, m0, r0, m1, r1, m2, r2);         \
+        MIXCOLUMNS(s1, m0, r0, m1, r1, m2, r2);         \
+        MIXCOLUMNS(s2, m0, r0, m1, r1, m2, r2);         \
+        MIXCOLUMNS(s3, m0, r0, m1, r1, m2, r2);         \
+    } while (0)
+
+#define ROUND(s0, s1, s2, s3, rtk23, m0, r0, m1, r1, m2, r2)  \
+    do {                                                \
+        SBOX(s0, s1, s2, s3);                           \
+        ADD_KEY(s0, s1, s2, s3, rtk23);                 \
+        MIXCOLUMNS(s0, m0, r0, m1, r1, m2, r2);         \
+        MIXCOLUMNS(s1, m0, r0, m1, r1, m2, r2);         \
+        MIXCOLUMNS(s2, m0, r0, m1, r1, m2, r2);         \
+        MIXCOLUMNS(s3, m0, r0, m1, r1, m2, r2);         \
+    } while (0)
+
+/* Bits of the cells on positions mask, rotated onto bit 0 of the next cell
+ * of the counter. */
+#define CARRY(x, mask, n) ROR((x) & (mask), n)
+
+
+static const uint8_t RC[SKINNY_ROUNDS] = {
+    0x01, 0x03, 0x07, 0x0F, 0x1F, 0x3E, 0x3D, 0x3B, 0x37, 0x2F,
+    0x1E, 0x3C, 0x39, 0x33, 0x27, 0x0E, 0x1D, 0x3A, 0x35, 0x2B,
+    0x16, 0x2C, 0x18, 0x30, 0x21, 0x02, 0x05, 0x0B, 0x17, 0x2E,
+    0x1C, 0x38, 0x31, 0x23, 0x06, 0x0D, 0x1B, 0x36, 0x2D, 0x1A
+};
+
+static const uint8_t TWEAKEY_P[16] = {
+    9, 15, 8, 13, 10, 14, 12, 11, 0, 1, 2, 3, 4, 5, 6, 7
+};
+
+/* RTK_CELLS[r%8][4*i+j] is the cell which, in round r, is stored on row i,
+ * column j. */
+static const uint8_t RTK_CELLS[8][16] = {
+    { 0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15},
+    { 4,  5,  6,  7,  9, 10, 11,  8, 14, 15, 12, 13,  3,  0,  1,  2},
+    { 9, 10, 11,  8, 15, 12, 13, 14,  1,  2,  3,  0,  7,  4,  5,  6},
+    {15, 12, 13, 14,  2,  3,  0,  1,  5,  6,  7,  4,  8,  9, 10, 11},
+    { 2,  3,  0,  1,  6,  7,  4,  5, 10, 11,  8,  9, 14, 15, 12, 13},
+    { 6,  7,  4,  5, 11,  8,  9, 10, 12, 13, 14, 15,  1,  2,  3,  0},
+    {11,  8,  9, 10, 13, 14, 15, 12,  3,  0,  1,  2,  5,  6,  7,  4},
+    {13, 14, 15, 12,  0,  1,  2,  3,  7,  4,  5,  6, 10, 11,  8,  9}
+};
+
+/* TK1_CELLS[r][4*i+j] is the TK1 cell which, in round 2*r, is added to row
+ * i, column j; 8 stands for the cells which get no round tweakey.  This
+ * folds 2*r applications of TWEAKEY_P into RTK_CELLS.  Only the top 8 cells
+ * of TK1 may be nonzero, so odd rounds, which take the bottom ones, get no
+ * TK1 round tweakey. */
+static const uint8_t TK1_CELLS[SKINNY_TK1_ROUNDS/2][16] = {
+    {0, 1, 2, 3, 4, 5, 6, 7, 8, 8, 8, 8, 8, 8, 8, 8},
+    {8, 8, 8, 8, 8, 8, 8, 8, 7, 0, 5, 1, 3, 2, 6, 4},
+    {1, 6, 7, 3, 2, 5, 0, 4, 8, 8, 8, 8, 8, 8, 8, 8},
+    {8, 8, 8, 8, 8, 8, 8, 8, 4, 3, 5, 7, 2, 0, 6, 1},
+    {5, 6, 3, 2, 7, 0, 1, 4, 8, 8, 8, 8, 8, 8, 8, 8},
+    {8, 8, 8, 8, 8, 8, 8, 8, 4, 5, 0, 6, 2, 3, 1, 7},
+    {6, 1, 4, 2, 3, 0, 5, 7, 8, 8, 8, 8, 8, 8, 8, 8},
+    {8, 8, 8, 8, 8, 8, 8, 8, 7, 2, 0, 4, 3, 5, 1, 6}
+};
+
+/* TK1 round tweakeys of the counter feedback polynomial, 0x95 in cell 0. */
+static const uint32_t TK1_FEEDBACK[SKINNY_RTK1_WORDS] = {
+    0x00000001, 0x00000000, 0x00000011, 0x00000010,
+    0x00000400, 0x00000000, 0x00004400, 0x00004000,
+    0x00020000, 0x00000000, 0x00220000, 0x00200000,
+    0x00000800, 0x00000000, 0x00008800, 0x00008000,
+    0x00000200, 0x00000000, 0x00002200, 0x00002000,
+    0x00040000, 0x00000000, 0x00440000, 0x00400000,
+    0x00000200, 0x00000000, 0x00002200, 0x00002000,
+    0x00040000, 0x00000000, 0x00440000, 0x00400000
+};
+
+
+static uint32_t _load32(const uint8_t bytes[4])
+{
+    return (uint32_t)bytes[0]
+        | (uint32_t)bytes[1] << 8
+        | (uint32_t)bytes[2] << 16
+        | (uint32_t)bytes[3] << 24;
+}
+
+static void _store32(uint8_t bytes[4], uint32_t w)
+{
+    bytes[0] = w;
+    bytes[1] = w >> 8;
+    bytes[2] = w >> 16;
+    bytes[3] = w >> 24;
+}
+
+/* Transposes rows and the 2 lower bits of the slice indices. */
+static void _pack(uint32_t w[4], const uint8_t cells[16])
+{
+    uint32_t x0 = _load32(cells);
+    uint32_t x1 = _load32(cells+4);
+    uint32_t x2 = _load32(cells+8);
+    uint32_t x3 = _load32(cells+12);
+
+    SWAPMOVE(x0, x1, 0x55555555, 1);
+    SWAPMOVE(x2, x3, 0x55555555, 1);
+    SWAPMOVE(x0, x2, 0x33333333, 2);
+    SWAPMOVE(x1, x3, 0x33333333, 2);
+
+    w[0] = x0;
+    w[1] = x3;
+    w[2] = x2;
+    w[3] = x1;
+}
+
+static void _unpack(uint8_t cells[16], const uint32_t w[4])
+{
+    uint32_t x0 = w[0];
+    uint32_t x1 = w[3];
+    uint32_t x2 = w[2];
+    uint32_t x3 = w[1];
+
+    SWAPMOVE(x0, x2, 0x33333333, 2);
+    SWAPMOVE(x1, x3, 0x33333333, 2);
+    SWAPMOVE(x0, x1, 0x55555555, 1);
+    SWAPMOVE(x2, x3, 0x55555555, 1);
+
+    _store32(cells, x0);
+    _store32(cells+4, x1);
+    _store32(cells+8, x2);
+    _store32(cells+12, x3);
+}
+
+static void _pack_round_tweakey(uint32_t rtk[4], const uint8_t cells[16])
+{
+    uint32_t w[4];
+    _pack(w, cells);
+
+    /* Round tweakeys are added right after the S-box, which leaves the
+     * slices of its first two words in the last two, and vice versa. */
+    rtk[0] = w[2];
+    rtk[1] = w[3];
+    rtk[2] = w[0];
+    rtk[3] = w[1];
+}
+
+static void _permute(uint8_t tk[16])
+{
+    uint8_t tmp[16];
+    for (size_t i=0; i<16; i++)
+    {
+        tmp[i] = tk[TWEAKEY_P[i]];
+    }
+    memcpy(tk, tmp, 16);
+}
+
+static uint8_t _lfsr2(uint8_t x)
+{
+    return (x<<1) ^ (x>>7 & 0x01) ^ (x>>5 & 0x01);
+}
+
+static uint8_t _lfsr3(uint8_t x)
+{
+    return (x>>1) ^ (x<<7 & 0x80) ^ (x<<1 & 0x80);
+}
+
+/* Lays out the top rows of the tweakey state TK (and the round constant
+ * when given TK3) as the round tweakey of round r. */
+static void _round_tweakey(uint32_t rtk[4], const uint8_t tk[16], size_t r,
+                           int constants)
+{
+    uint8_t rk[16] = {0};
+    uint8_t cells[16];
+
+    memcpy(rk, tk, 8);
+
+    if (constants)
+    {
+        rk[0] ^= RC[r] & 0xf;
+        rk[4] ^= RC[r] >> 4;
+        rk[8] ^= 0x2;
+    }
+
+    for (size_t i=0; i<16; i++)
+    {
+        cells[i] = rk[RTK_CELLS[r%8][i]];
+    }
+
+    _pack_round_tweakey(rtk, cells);
+}
+
+
+/* Multiplies the counter by 2 in the TK1 round tweakey of one round, given
+ * the carries from bit 7 of each cell of the counter to bit 0 of the next:
+ * every other bit moves up by one slice, from slice 3 to slice 4 within the
+ * cell. */
+static void _tk1_double(uint32_t rtk[4], uint32_t carries)
+{
+    uint32_t x = rtk[3];
+
+    rtk[3] = rtk[0];
+    rtk[0] = rtk[1];
+    rtk[1] = rtk[2];
+    rtk[2] = (x & 0x0f0f0f0f) << 4 | carries;
+}
+
+
+void skinny_tk1_schedule(uint32_t rtk1[SKINNY_RTK1_WORDS],
+                         const uint8_t tk1[8])
+{
+    uint8_t tk[9];
+    uint8_t cells[16];
+
+    memcpy(tk, tk1, 8);
+    tk[8] = 0;
+
+    for (size_t r=0; r<SKINNY_TK1_ROUNDS/2; r++)
+    {
+        for (size_t i=0; i<16; i++)
+        {
+            cells[i] = tk[TK1_CELLS[r][i]];
+        }
+        _pack_round_tweakey(rtk1 + 4*r, cells);
+    }
+}
+
+void skinny_tk1_double(uint32_t rtk1[SKINNY_RTK1_WORDS])
+{
+    /* Bit 7 of cell 6, i.e. of the counter, sits on bit 21 of the last word
+     * in round 0. */
+    uint32_t feedback = -((rtk1[3] >> 21) & 1);
+    uint32_t *k;
+
+    k = rtk1;
+    _tk1_double(k, CARRY(k[3], 0x00103030, 28) | CARRY(k[3], 0x10000000, 27));
+
+    k = rtk1 + 4;
+    _tk1_double(k, CARRY(k[3], 0x00004000, 20) | CARRY(k[3], 0x40000000, 19)
+                 | CARRY(k[3], 0x00008080, 12) | CARRY(k[3], 0x80000000, 13)
+                 | CARRY(k[3], 0x00400000, 3));
+
+    k = rtk1 + 8;
+    _tk1_double(k, CARRY(k[3], 0x00200000, 21) | CARRY(k[3], 0x10000010, 3)
+                 | CARRY(k[3], 0x00000020, 13) | CARRY(k[3], 0x20000000, 20)
+                 | CARRY(k[3], 0x00002000, 5));
+
+    k = rtk1 + 12;
+    _tk1_double(k, CARRY(k[3], 0x00008040, 20) | CARRY(k[3], 0x80000000, 28)
+                 | CARRY(k[3], 0x00000080, 29) | CARRY(k[3], 0x00004000, 12)
+                 | CARRY(k[3], 0x00400000, 3));
+
+    k = rtk1 + 16;
+    _tk1_double(k, CARRY(k[3], 0x00002010, 28) | CARRY(k[3], 0x20200000, 29)
+                 | CARRY(k[3], 0x10000000, 12) | CARRY(k[3], 0x00100000, 27));
+
+    k = rtk1 + 20;
+    _tk1_double(k, CARRY(k[3], 0x00400000, 3) | CARRY(k[3], 0x00804000, 20)
+                 | CARRY(k[3], 0x000000c0, 28) | CARRY(k[3], 0x00008000, 13));
+
+    k = rtk1 + 24;
+    _tk1_double(k, CARRY(k[3], 0x00002000, 5) | CARRY(k[3], 0x00001000, 20)
+                 | CARRY(k[3], 0x10000000, 27) | CARRY(k[3], 0x00200020, 21)
+                 | CARRY(k[3], 0x00100000, 3));
+
+    k = rtk1 + 28;
+    _tk1_double(k, CARRY(k[3], 0x00400000, 3) | CARRY(k[3], 0x00800080, 13)
+                 | CARRY(k[3], 0x00004000, 11) | CARRY(k[3], 0x40000000, 19)
+                 | CARRY(k[3], 0x00008000, 20));
+
+    for (size_t i=0; i<SKINNY_RTK1_WORDS; i++)
+    {
+        rtk1[i] ^= TK1_FEEDBACK[i] & feedback;
+    }
+}
+
+void skinny_tk3_schedule(uint32_t rtk3[SKINNY_RTK_WORDS],
+                         const uint8_t tk3[16])
+{
+    uint8_t tk[16];
+    memcpy(tk, tk3, 16);
+
+    for (size_t r=0; r<SKINNY_ROUNDS; r++)
+    {
+        _round_tweakey(rtk3 + 4*r, tk, r, 1);
+
+        _permute(tk);
+        for (size_t i=0; i<8; i++)
+        {
+            tk[i] = _lfsr3(tk[i]);
+        }
+    }
+}
+
+void skinny_tk2_schedule(uint32_t rtk23[SKINNY_RTK_WORDS],
+                         const uint32_t rtk3[SKINNY_RTK_WORDS],
+                         const uint8_t tk2[16])
+{
+    uint8_t tk[16];
+    memcpy(tk, tk2, 16);
+
+    for (size_t r=0; r<SKINNY_ROUNDS; r++)
+    {
+        _round_tweakey(rtk23 + 4*r, tk, r, 0);
+
+        for (size_t i=0; i<4; i++)
+        {
+            rtk23[4*r+i] ^= rtk3[4*r+i];
+        }
+
+        _permute(tk);
+        for (size_t i=0; i<8; i++)
+        {
+            tk[i] = _lfsr2(tk[i]);
+        }
+    }
+}
+
+void skinny_128_384_plus_enc(uint8_t block[16],
+                             const uint32_t rtk1[SKINNY_RTK1_WORDS],
+                             const uint32_t rtk23[SKINNY_RTK_WORDS])
+{
+    uint32_t s[4];
+    _pack(s, block);
+
+    uint32_t s0 = s[0], s1 = s[1], s2 = s[2], s3 = s[3];
+
+    for (size_t r=0; r<SKINNY_ROUNDS; r+=4)
+    {
+        const uint32_t *k1 = rtk1 + 2*(r % SKINNY_TK1_ROUNDS);
+        const uint32_t *k23 = rtk23 + 4*r;
+
+        ROUND_TK1(s0, s1, s2, s3, k1, k23,  ROW2, 25, ROW0, 14, ROW2,  7);
+        ROUND(s2, s3, s0, s1, k23+4,        ROW1, 17, ROW3,  2, ROW1, 15);
+        ROUND_TK1(s0, s1, s2, s3, k1+4, k23+8, ROW0, 5, ROW2, 18, ROW0, 23);
+        ROUND(s2, s3, s0, s1, k23+12,       ROW3,  1, ROW1, 30, ROW3,  3);
+    }
+
+    s[0] = s0; s[1] = s1; s[2] = s2; s[3] = s3;
+    _unpack(block, s);
+}
@@ -0,0 +1 @@
+../../Romulus-N_vref/source/test_vectors.c
\ No newline at end of file
@@ -0,0 +1 @@
+../../Romulus-N_vref/source/variant.h
\ No newline at end of file
@@ -181,17 +181,41 @@ void block_cipher(unsigned char* s,
 
 }
 
-// Calls the TBC using the nonce as part of the tweakey
-void nonce_encryption (const unsigned char* N,
-		       unsigned char* CNT,
-		       unsigned char*s, const unsigned char* k,
-		       int t, unsigned char D) {
-  unsigned char T [16];
-  int i;  
+// Computes once per message the round tweakeys of the nonce and key lanes,
+// which stay the same for every nonce_encryption() call
+void nonce_schedule (unsigned char* RTK,
+		     const unsigned char* N,
+		     const unsigned char* k,
+		     int t) {
+  unsigned char TK23 [32];
+  int i;
   for (i = 0; i < t; i++) {
-    T[i] = N[i];
-  }  
-  block_cipher(s,k,T,CNT,D,t);
+    TK23[i] = N[i];
+  }
+  for (i = 0; i < 16; i++) {
+    TK23[i+t] = k[i];
+  }
+  skinny_128_384_plus_tk23_schedule(RTK, TK23);
+
+}
+
+// Calls the TBC using the nonce as part of the tweakey: only the counter
+// and domain lane is evolved, on top of the round tweakeys from
+// nonce_schedule()
+void nonce_encryption (const unsigned char* RTK,
+		       unsigned char* CNT,
+		       unsigned char*s,
+		       unsigned char D) {
+  unsigned char TK1 [16];
+  int i;
+  for (i = 0; i < 7; i++) {
+    TK1[i] = CNT[i];
+  }
+  TK1[i] = D;
+  for (i = 8; i < 16; i++) {
+    TK1[i] = 0x00;
+  }
+  skinny_128_384_plus_enc_tk1(s,TK1,RTK);
 
 }
 
@@ -207,10 +231,10 @@ void generate_tag (unsigned char** c, unsigned char* s,
 
 // Absorbs and encrypts the message blocks.
 size_t msg_encryption (const unsigned char** M, unsigned char** c,
-				   const unsigned char* N,
+				   const unsigned char* RTK,
 				   unsigned char* CNT,
-				   unsigned char*s, const unsigned char* k,
-				   unsigned int n, unsigned int t, unsigned char D,
+				   unsigned char*s,
+				   unsigned int n, unsigned char D,
 				   size_t mlen, char d) {
   int len8;
 
@@ -232,7 +256,7 @@ size_t msg_encryption (const unsigned char** M, unsigned char** c,
   *c = *c + len8;
   *M = *M + len8;
   lfsr_gf56(CNT);
-  nonce_encryption(N,CNT,s,k,t,D);
+  nonce_encryption(RTK,CNT,s,D);
   return mlen;
 }
 
@@ -288,6 +312,7 @@ int romulus_n (
   unsigned char s[16];
   unsigned char CNT[7];
   unsigned char T[16];
+  unsigned char RTK[SKINNY_RTK23_BYTES];
   const unsigned char* A;
   const unsigned char* I;
   const unsigned char* N;
@@ -304,27 +329,28 @@ int romulus_n (
     s[i] = 0;
   }      
   reset_lfsr_gf56(CNT);
+  nonce_schedule(RTK,N,k,t);
 
   if (adlen == 0) { // AD is an empty string
     lfsr_gf56(CNT);
-    nonce_encryption(N,CNT,s,k,t,0x1a);
+    nonce_encryption(RTK,CNT,s,0x1a);
   }
   else while (adlen > 0) {
       if (adlen < n) { // The last block of AD is odd and incomplete
 	adlen = ad_encryption(&A,s,k,adlen,CNT,0x08,n,t);
-	nonce_encryption(N,CNT,s,k,t,0x1a);
+	nonce_encryption(RTK,CNT,s,0x1a);
       }
       else if (adlen == n) { // The last block of AD is odd and complete
 	adlen = ad_encryption(&A,s,k,adlen,CNT,0x08,n,t);
-	nonce_encryption(N,CNT,s,k,t,0x18); 
+	nonce_encryption(RTK,CNT,s,0x18); 
       }    
       else if (adlen < (n+t)) { // The last block of AD is even and incomplete
 	adlen = ad_encryption(&A,s,k,adlen,CNT,0x08,n,t);
-	nonce_encryption(N,CNT,s,k,t,0x1a); 
+	nonce_encryption(RTK,CNT,s,0x1a); 
       }
       else if (adlen == (n+t)) { // The last block of AD is even and complete
 	adlen = ad_encryption(&A,s,k,adlen,CNT,0x08,n,t);
-	nonce_encryption(N,CNT,s,k,t,0x18); 
+	nonce_encryption(RTK,CNT,s,0x18); 
       }
       else { // A normal full pair of blocks of AD
 	adlen = ad_encryption(&A,s,k,adlen,CNT,0x08,n,t);
@@ -344,17 +370,17 @@ int romulus_n (
   
   if (mlen == 0) { // M is an empty string
     lfsr_gf56(CNT);
-    nonce_encryption(N,CNT,s,k,t,0x15);
+    nonce_encryption(RTK,CNT,s,0x15);
   }  
   else while (mlen > 0) {
     if (mlen < n) { // The last block of M is incomplete
-      mlen = msg_encryption(&I,&c,N,CNT,s,k,n,t,0x15,mlen,d);
+      mlen = msg_encryption(&I,&c,RTK,CNT,s,n,0x15,mlen,d);
     }
     else if (mlen == n) { // The last block of M is complete
-      mlen = msg_encryption(&I,&c,N,CNT,s,k,n,t,0x14,mlen,d);
+      mlen = msg_encryption(&I,&c,RTK,CNT,s,n,0x14,mlen,d);
     }
     else { // A normal full message block
-      mlen = msg_encryption(&I,&c,N,CNT,s,k,n,t,0x04,mlen,d);
+      mlen = msg_encryption(&I,&c,RTK,CNT,s,n,0x04,mlen,d);
     }
   }
 
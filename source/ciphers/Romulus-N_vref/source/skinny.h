@@ -1 +1,6 @@
 extern void skinny_128_384_plus_enc (unsigned char* input, const unsigned char* userkey);
+
+#define SKINNY_RTK23_BYTES (40*8)
+
+extern void skinny_128_384_plus_tk23_schedule (unsigned char* rtk23, const unsigned char* tk23);
+extern void skinny_128_384_plus_enc_tk1 (unsigned char* input, const unsigned char* tk1, const unsigned char* rtk23);
@@ -244,3 +244,82 @@ void skinny_128_384_plus_enc (unsigned char* input, const unsigned char* userkey
  	enc(input,userkey); 
 }
 
+// Incremental variant, for tweakeys whose TK2 and TK3 stay the same across
+// calls (e.g. the nonce and the key in Romulus-N): the two top rows of
+// TK2 xor TK3 are computed once for every round, and only TK1 is evolved
+// when encrypting.
+
+// Stores the round tweakeys of TK2 and TK3 (8 bytes per round) in rtk23,
+// given tk23 = TK2 || TK3.
+void skinny_128_384_plus_tk23_schedule (unsigned char* rtk23, const unsigned char* tk23)
+{
+	unsigned char state[4][4];
+	unsigned char keyCells[3][4][4];
+	int i, j;
+
+	for(i = 0; i < 16; i++) {
+        keyCells[0][i>>2][i&0x3] = 0;
+        keyCells[1][i>>2][i&0x3] = tk23[i]&0xFF;
+        keyCells[2][i>>2][i&0x3] = tk23[i+16]&0xFF;
+	}
+
+	// With TK1 set to zero, AddKey on an empty state yields TK2 xor TK3.
+	for(i = 0; i < N_RNDS; i++){
+        for(j = 0; j < 8; j++) state[j>>2][j&0x3] = 0;
+        AddKey(state, keyCells);
+        for(j = 0; j < 8; j++) rtk23[8*i+j] = state[j>>2][j&0x3];
+	}
+}
+
+// Extract and apply the subtweakey made of TK1 and the precomputed TK2 xor
+// TK3 rows, then update TK1 (which has no LFSR)
+void AddKeyTK1(unsigned char state[4][4], unsigned char keyCells[4][4], const unsigned char* rtk23)
+{
+	int i, j;
+	unsigned char pos;
+	unsigned char keyCells_tmp[4][4];
+
+    for(i = 0; i <= 1; i++)
+    {
+        for(j = 0; j < 4; j++)
+        {
+            state[i][j] ^= keyCells[i][j] ^ rtk23[4*i+j];
+        }
+    }
+    for(i = 0; i < 4; i++){
+        for(j = 0; j < 4; j++){
+            pos=TWEAKEY_P[j+4*i];
+            keyCells_tmp[i][j]=keyCells[pos>>2][pos&0x3];
+        }
+    }
+    for(i = 0; i < 4; i++){
+        for(j = 0; j < 4; j++){
+            keyCells[i][j]=keyCells_tmp[i][j];
+        }
+    }
+}
+
+// encryption function of Skinny-128-384+, with the round tweakeys of TK2 and
+// TK3 computed by skinny_128_384_plus_tk23_schedule
+void skinny_128_384_plus_enc_tk1 (unsigned char* input, const unsigned char* tk1, const unsigned char* rtk23)
+{
+	unsigned char state[4][4];
+	unsigned char keyCells[4][4];
+	int i;
+
+	for(i = 0; i < 16; i++) {
+        state[i>>2][i&0x3] = input[i]&0xFF;
+        keyCells[i>>2][i&0x3] = tk1[i]&0xFF;
+	}
+
+	for(i = 0; i < N_RNDS; i++){
+        SubCell8(state);
+	    AddConstants(state, i);
+	    AddKeyTK1(state, keyCells, rtk23 + 8*i);
+	    ShiftRows(state);
+	    MixColumn(state);
+	}
+
+    for(i = 0; i < 16; i++)
+		input[i] = state[i>>2][i&0x3] & 0xFF;
+}
@@ -0,0 +1 @@
+../../SKINNY-AEAD-M1-128_vref/source/api.h
\ No newline at end of file
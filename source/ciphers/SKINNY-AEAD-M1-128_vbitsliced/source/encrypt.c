@@ -0,0 +1 @@
+../../SKINNY-AEAD-M1-128_vref/source/encrypt.c
\ No newline at end of file
@@ -0,0 +1 @@
+../../SKINNY-AEAD-M1-128_vref/source/skinny_aead.h
\ No newline at end of file
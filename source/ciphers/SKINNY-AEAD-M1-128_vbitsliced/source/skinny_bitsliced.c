@@ -0,0 +1,289 @@
+/*
+ * SKINNY-128-384 Bitsliced C Implementation
+ *
+ * Copyright 2026:
+ *     FELICS-AE contributors
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ *
+ */
+
+#include <string.h>
+#include <stdint.h>
+#include "skinny_bitsliced.h"
+
+/*
+** The state is an array of 128 words: word 8*i+b holds bit b of cell i of
+** every block.  ShiftRows is a mere renaming of words, folded into
+** MixColumn; the 8-bit Sbox is computed with its decomposition into four
+** steps x4 ^= ~(x7|x6), x0 ^= ~(x3|x2), separated by bit permutations which
+** are renamings as well.
+*/
+
+typedef uint64_t word_t;
+
+// ShiftAndSwitchRows permutation
+static const uint8_t P[16] = {0,1,2,3,7,4,5,6,10,11,8,9,13,14,15,12};
+
+// Tweakey permutation
+static const uint8_t TWEAKEY_P[16] = {9,15,8,13,10,14,12,11,0,1,2,3,4,5,6,7};
+
+// TK1 has no LFSR: after r rounds, its cell i is the initial cell
+// TK1_CELLS[r%16][i].
+static const uint8_t TK1_CELLS[16][8] = {
+    { 0,  1,  2,  3,  4,  5,  6,  7},
+    { 9, 15,  8, 13, 10, 14, 12, 11},
+    { 1,  7,  0,  5,  2,  6,  4,  3},
+    {15, 11,  9, 14,  8, 12, 10, 13},
+    { 7,  3,  1,  6,  0,  4,  2,  5},
+    {11, 13, 15, 12,  9, 10,  8, 14},
+    { 3,  5,  7,  4,  1,  2,  0,  6},
+    {13, 14, 11, 10, 15,  8,  9, 12},
+    { 5,  6,  3,  2,  7,  0,  1,  4},
+    {14, 12, 13,  8, 11,  9, 15, 10},
+    { 6,  4,  5,  0,  3,  1,  7,  2},
+    {12, 10, 14,  9, 13, 15, 11,  8},
+    { 4,  2,  6,  1,  5,  7,  3,  0},
+    {10,  8, 12, 15, 14, 11, 13,  9},
+    { 2,  0,  4,  7,  6,  3,  5,  1},
+    { 8,  9, 10, 11, 12, 13, 14, 15}
+};
+
+/*
+** Transpose a 64x64 bit matrix: bit j of a[i] becomes bit i of a[j]
+*/
+static void transpose64(word_t a[64]) {
+
+    static const word_t masks[6] = {
+        0x00000000ffffffff, 0x0000ffff0000ffff, 0x00ff00ff00ff00ff,
+        0x0f0f0f0f0f0f0f0f, 0x3333333333333333, 0x5555555555555555
+    };
+
+    for (int l = 0, s = 32; s != 0; l++, s >>= 1) {
+        for (int i = 0; i < 64; i++) {
+            if (i & s) continue;
+            word_t t = ((a[i] >> s) ^ a[i+s]) & masks[l];
+            a[i+s] ^= t;
+            a[i] ^= t << s;
+        }/*i*/
+    }/*l*/
+
+}
+
+static word_t load64(const uint8_t *bytes) {
+    word_t w = 0;
+    for (int i = 7; i >= 0; i--) w = (w << 8) | bytes[i];
+    return w;
+}
+
+static void store64(uint8_t *bytes, word_t w) {
+    for (int i = 0; i < 8; i++) bytes[i] = (w >> (8*i)) & 0xff;
+}
+
+/*
+** Bitslice 16-byte blocks, which lie stride bytes apart
+*/
+static void pack(word_t S[128], const uint8_t *blocks, size_t stride, size_t n) {
+
+    for (int h = 0; h < 2; h++) {
+        word_t *half = S + 64*h;
+        for (size_t j = 0; j < SKINNY_BS_LANES; j++) {
+            half[j] = j < n ? load64(blocks + stride*j + 8*h) : 0;
+        }/*j*/
+        transpose64(half);
+    }/*h*/
+
+}
+
+static void unpack(uint8_t *blocks, word_t S[128], size_t n) {
+
+    for (int h = 0; h < 2; h++) {
+        word_t *half = S + 64*h;
+        transpose64(half);
+        for (size_t j = 0; j < n; j++) {
+            store64(blocks + 16*j + 8*h, half[j]);
+        }/*j*/
+    }/*h*/
+
+}
+
+/*
+** Sbox of one cell, and its inverse; x[b] is bit b
+*/
+#define NOR_STEP(t, a, b) (t) ^= ~((a) | (b))
+
+static void SubCell8(word_t x[8]) {
+
+    word_t a0 = x[0], a1 = x[1], a2 = x[2], a3 = x[3];
+    word_t a4 = x[4], a5 = x[5], a6 = x[6], a7 = x[7];
+
+    NOR_STEP(a4, a7, a6); NOR_STEP(a0, a3, a2);
+    NOR_STEP(a6, a2, a1); NOR_STEP(a5, a4, a0);
+    NOR_STEP(a1, a0, a3); NOR_STEP(a7, a6, a5);
+    NOR_STEP(a3, a5, a4); NOR_STEP(a2, a1, a7);
+
+    x[7] = a5; x[6] = a4; x[5] = a0; x[4] = a3;
+    x[3] = a1; x[2] = a6; x[1] = a7; x[0] = a2;
+
+}
+
+static void SubCell8_inv(word_t x[8]) {
+
+    word_t a5 = x[7], a4 = x[6], a0 = x[5], a3 = x[4];
+    word_t a1 = x[3], a6 = x[2], a7 = x[1], a2 = x[0];
+
+    NOR_STEP(a3, a5, a4); NOR_STEP(a2, a1, a7);
+    NOR_STEP(a1, a0, a3); NOR_STEP(a7, a6, a5);
+    NOR_STEP(a6, a2, a1); NOR_STEP(a5, a4, a0);
+    NOR_STEP(a4, a7, a6); NOR_STEP(a0, a3, a2);
+
+    x[0] = a0; x[1] = a1; x[2] = a2; x[3] = a3;
+    x[4] = a4; x[5] = a5; x[6] = a6; x[7] = a7;
+
+}
+
+/*
+** Add the round constant of row 2 and the subtweakey of round r
+*/
+static void AddKey(word_t S[128], const word_t TK1[128],
+                   const uint8_t rtk23[8], int r) {
+
+    const uint8_t *cells = TK1_CELLS[r%16];
+
+    for (int i = 0; i < 8; i++) {
+        const word_t *tk1 = TK1 + 8*cells[i];
+        for (int b = 0; b < 8; b++) {
+            S[8*i+b] ^= tk1[b] ^ (0 - (word_t)((rtk23[i] >> b) & 1));
+        }/*b*/
+    }/*i*/
+
+    S[8*8+1] = ~S[8*8+1];
+
+}
+
+/*
+** ShiftRows then MixColumn, from S into T
+*/
+static void ShiftRowsMixColumn(word_t T[128], const word_t S[128]) {
+
+    for (int j = 0; j < 4; j++) {
+        for (int b = 0; b < 8; b++) {
+            word_t a0 = S[8*P[j]+b];
+            word_t a1 = S[8*P[4+j]+b];
+            word_t a2 = S[8*P[8+j]+b];
+            word_t a3 = S[8*P[12+j]+b];
+            a1 ^= a2;
+            a2 ^= a0;
+            a3 ^= a2;
+            T[8*j+b]      = a3;
+            T[8*(4+j)+b]  = a0;
+            T[8*(8+j)+b]  = a1;
+            T[8*(12+j)+b] = a2;
+        }/*b*/
+    }/*j*/
+
+}
+
+static void ShiftRowsMixColumn_inv(word_t T[128], const word_t S[128]) {
+
+    for (int j = 0; j < 4; j++) {
+        for (int b = 0; b < 8; b++) {
+            word_t a3 = S[8*j+b];
+            word_t a0 = S[8*(4+j)+b];
+            word_t a1 = S[8*(8+j)+b];
+            word_t a2 = S[8*(12+j)+b];
+            a3 ^= a2;
+            a2 ^= a0;
+            a1 ^= a2;
+            T[8*P[j]+b]    = a0;
+            T[8*P[4+j]+b]  = a1;
+            T[8*P[8+j]+b]  = a2;
+            T[8*P[12+j]+b] = a3;
+        }/*b*/
+    }/*j*/
+
+}
+
+void skinny_bs_tk23_schedule(uint8_t rtk23[SKINNY_BS_ROUNDS][8],
+                             const uint8_t *tk2, const uint8_t *tk3) {
+
+    uint8_t TK2[16], TK3[16], tmp[16];
+    uint8_t rc = 0;
+
+    memcpy(TK2, tk2, 16);
+    memcpy(TK3, tk3, 16);
+
+    for (int r = 0; r < SKINNY_BS_ROUNDS; r++) {
+
+        // 6-bit LFSR of the round constants
+        rc = ((rc << 1) & 0x3f) ^ ((rc >> 5) & 1) ^ ((rc >> 4) & 1) ^ 1;
+
+        for (int i = 0; i < 8; i++) rtk23[r][i] = TK2[i] ^ TK3[i];
+        rtk23[r][0] ^= rc & 0xf;
+        rtk23[r][4] ^= (rc >> 4) & 0x3;
+
+        for (int i = 0; i < 16; i++) tmp[i] = TK2[TWEAKEY_P[i]];
+        memcpy(TK2, tmp, 16);
+        for (int i = 0; i < 16; i++) tmp[i] = TK3[TWEAKEY_P[i]];
+        memcpy(TK3, tmp, 16);
+
+        for (int i = 0; i < 8; i++) {
+            TK2[i] = ((TK2[i]<<1)&0xFE) ^ ((TK2[i]>>7)&0x01) ^ ((TK2[i]>>5)&0x01);
+            TK3[i] = ((TK3[i]>>1)&0x7F) ^ ((TK3[i]<<7)&0x80) ^ ((TK3[i]<<1)&0x80);
+        }/*i*/
+    }/*r*/
+
+}
+
+void skinny_bs_enc(const uint8_t *input, const uint8_t (*tk1)[16],
+                   const uint8_t rtk23[SKINNY_BS_ROUNDS][8],
+                   uint8_t *output, size_t blocks) {
+
+    word_t S[128], T[128], TK1[128];
+
+    pack(S, input, 16, blocks);
+    pack(TK1, tk1[0], 16, blocks);
+
+    for (int r = 0; r < SKINNY_BS_ROUNDS; r++) {
+        for (int i = 0; i < 16; i++) SubCell8(S + 8*i);
+        AddKey(S, TK1, rtk23[r], r);
+        ShiftRowsMixColumn(T, S);
+        memcpy(S, T, sizeof(S));
+    }/*r*/
+
+    unpack(output, S, blocks);
+
+}
+
+void skinny_bs_dec(const uint8_t *input, const uint8_t (*tk1)[16],
+                   const uint8_t rtk23[SKINNY_BS_ROUNDS][8],
+                   uint8_t *output, size_t blocks) {
+
+    word_t S[128], T[128], TK1[128];
+
+    pack(S, input, 16, blocks);
+    pack(TK1, tk1[0], 16, blocks);
+
+    for (int r = SKINNY_BS_ROUNDS-1; r >= 0; r--) {
+        ShiftRowsMixColumn_inv(T, S);
+        AddKey(T, TK1, rtk23[r], r);
+        for (int i = 0; i < 16; i++) SubCell8_inv(T + 8*i);
+        memcpy(S, T, sizeof(S));
+    }/*r*/
+
+    unpack(output, S, blocks);
+
+}
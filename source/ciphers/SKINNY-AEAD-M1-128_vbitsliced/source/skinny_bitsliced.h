@@ -0,0 +1,47 @@
+/*
+ * SKINNY-128-384 Bitsliced C Implementation
+ *
+ * Copyright 2026:
+ *     FELICS-AE contributors
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ *
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+** SKINNY-128-384 on up to SKINNY_BS_LANES blocks at once, bitsliced over
+** 64-bit words: block i goes in bit i of every word.
+**
+** All blocks share TK2 and TK3, whose round tweakeys are computed once with
+** skinny_bs_tk23_schedule(); each block has its own TK1.
+*/
+#define SKINNY_BS_LANES  64
+#define SKINNY_BS_ROUNDS 56
+
+/* Two top rows of TK2 xor TK3 for every round, round constants included */
+void skinny_bs_tk23_schedule(uint8_t rtk23[SKINNY_BS_ROUNDS][8],
+                             const uint8_t *tk2, const uint8_t *tk3);
+
+void skinny_bs_enc(const uint8_t *input, const uint8_t (*tk1)[16],
+                   const uint8_t rtk23[SKINNY_BS_ROUNDS][8],
+                   uint8_t *output, size_t blocks);
+
+void skinny_bs_dec(const uint8_t *input, const uint8_t (*tk1)[16],
+                   const uint8_t rtk23[SKINNY_BS_ROUNDS][8],
+                   uint8_t *output, size_t blocks);
@@ -0,0 +1 @@
+../../SKINNY-AEAD-M1-128_vref/source/skinny_reference.c
\ No newline at end of file
@@ -0,0 +1 @@
+../../SKINNY-AEAD-M1-128_vref/source/skinny_reference.h
\ No newline at end of file
@@ -0,0 +1 @@
+../../SKINNY-AEAD-M1-128_vref/source/test_vectors.c
\ No newline at end of file
@@ -0,0 +1 @@
+../../SUNDAE-GIFT-96-128_vref/source/api.h
\ No newline at end of file
@@ -0,0 +1 @@
+../../SUNDAE-GIFT-96-128_vref/source/encrypt.c
\ No newline at end of file
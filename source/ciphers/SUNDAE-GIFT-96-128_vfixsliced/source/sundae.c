@@ -0,0 +1,197 @@
+/*
+SUNDAE AEAD scheme
+Prepared by: Siang Meng Sim
+Email: crypto.s.m.sim@gmail.com
+Date: 25 Mar 2019
+
+Modified in 2026 by FELICS-AE contributors: fixsliced GIFT-128 (see
+gift128.h), with the round keys computed once per message; the nonce,
+associated data and message are absorbed from the caller's buffers, without
+heap allocation, through the streaming API of sundae.h.
+*/
+#include <stdint.h>
+
+#include "sundae.h"
+
+static void doubling(uint8_t* A){
+/*doubling uses x^{16} + x^5 + x^3 + x + 1 at byte level*/
+uint8_t ADD=A[0];
+int i;
+for(i=0; i<15; i++){
+    A[i] = A[i+1];
+}
+A[15] = ADD;
+A[14] ^= ADD;
+A[12] ^= ADD;
+A[10] ^= ADD;
+
+return;
+}
+
+void sundae_setkey(sundae_ctx* ctx, const uint8_t K[16]){
+giftb128_keyschedule(ctx->rkey,K);
+}
+
+int sundae_start(sundae_ctx* ctx, unsigned Nlen, int hasA, int hasM){
+/*
+member 1 takes 96-bit nonce   (Nlen = 12)
+member 2 does not take in nonce (Nlen = 0)
+member 3 takes 128-bit nonce  (Nlen = 16)
+member 4 takes 64-bit nonce   (Nlen = 8)
+*/
+uint8_t ib[16]={0};
+
+if(hasA) ib[0] |= 0x80;
+if(hasM) ib[0] |= 0x40;
+
+if(Nlen==16) ib[0] |= 0xb0;
+else if(Nlen==12) ib[0] |= 0xa0;
+else if(Nlen==8) ib[0] |= 0x90;
+else if(Nlen!=0) return -1; /*Invalid nonce length*/
+
+/*Initialisation*/
+giftb128_encrypt_block(ctx->V,ctx->rkey,ib);
+ctx->pos = 0;
+return 0;
+}
+
+/*
+The last block of each input is processed differently, so that a full block
+is only encrypted once the next byte comes.
+*/
+void sundae_absorb(sundae_ctx* ctx, const uint8_t* X, unsigned long long Xlen){
+unsigned pos = ctx->pos;
+
+while(Xlen>0){
+    if(pos==16){
+        giftb128_encrypt_block(ctx->V,ctx->rkey,ctx->V);
+        pos = 0;
+    }
+    ctx->V[pos++]^=*X++;
+    Xlen--;
+}
+ctx->pos = pos;
+}
+
+void sundae_next(sundae_ctx* ctx){
+if(ctx->pos==16){
+    doubling(ctx->V);
+    doubling(ctx->V);
+    giftb128_encrypt_block(ctx->V,ctx->rkey,ctx->V);
+}
+else if(ctx->pos>0){
+    /*10*-padding*/
+    ctx->V[ctx->pos]^=0x80;
+
+    doubling(ctx->V);
+    giftb128_encrypt_block(ctx->V,ctx->rkey,ctx->V);
+}
+ctx->pos = 0;
+}
+
+void sundae_tag(sundae_ctx* ctx, uint8_t T[16]){
+int i;
+
+sundae_next(ctx);
+for(i=0; i<16; i++){
+    T[i]=ctx->V[i];
+}
+}
+
+void sundae_ofb_start(sundae_ctx* ctx, const uint8_t T[16]){
+int i;
+
+for(i=0; i<16; i++){
+    ctx->V[i]=T[i];
+}
+ctx->pos = 16;
+}
+
+void sundae_ofb(sundae_ctx* ctx, uint8_t* out, const uint8_t* in, unsigned long long len){
+unsigned pos = ctx->pos;
+
+while(len>0){
+    if(pos==16){
+        giftb128_encrypt_block(ctx->V,ctx->rkey,ctx->V);
+        pos = 0;
+    }
+    *out++ = *in++ ^ ctx->V[pos++];
+    len--;
+}
+ctx->pos = pos;
+}
+
+/* ------------------------------------------------------------------------- */
+
+static void sundae_mac(sundae_ctx* ctx,
+                const uint8_t* N, unsigned long long Nlen,
+                const uint8_t* A, unsigned long long Alen,
+                const uint8_t* M, unsigned long long Mlen,
+                uint8_t T[16]){
+/*Prepend N to A*/
+sundae_absorb(ctx,N,Nlen);
+sundae_absorb(ctx,A,Alen);
+sundae_next(ctx);
+
+sundae_absorb(ctx,M,Mlen);
+sundae_tag(ctx,T);
+}
+
+int sundae_enc(const uint8_t* N, unsigned long long Nlen,
+                const uint8_t* A, unsigned long long Alen,
+                const uint8_t* M, unsigned long long Mlen,
+                const uint8_t K[16],
+                uint8_t* C,
+                int outputTag){
+/*
+return -1 if invalid parameter
+return 0 if encryption successful
+*/
+sundae_ctx ctx;
+
+sundae_setkey(&ctx,K);
+if(sundae_start(&ctx,Nlen,Alen!=0,Mlen!=0)) return -1;
+
+/*output the Tag*/
+sundae_mac(&ctx,N,Nlen,A,Alen,M,Mlen,C);
+
+if(outputTag) return 0; /*for decryption, early termination*/
+
+/*output C*/
+sundae_ofb_start(&ctx,C);
+sundae_ofb(&ctx,C+16,M,Mlen);
+
+return 0;}
+
+
+int sundae_dec(const uint8_t* N, unsigned long long Nlen,
+                const uint8_t* A, unsigned long long Alen,
+                uint8_t* M,
+                const uint8_t K[16],
+                const uint8_t* C, unsigned long long Clen){
+/*
+-1 for authentication fail
+-2 for invalid tag length
+*/
+sundae_ctx ctx;
+uint8_t Tprime[16];
+uint8_t diff=0;
+unsigned long long i;
+
+if(Clen<16) return -2; /*invalid tag length*/
+
+sundae_setkey(&ctx,K);
+
+/*Decrypt C*/
+sundae_ofb_start(&ctx,C);
+sundae_ofb(&ctx,M,C+16,Clen-16);
+
+/*Generate T*/
+if(sundae_start(&ctx,Nlen,Alen!=0,Clen!=16)) return -1;
+sundae_mac(&ctx,N,Nlen,A,Alen,M,Clen-16,Tprime);
+
+/*Match tags*/
+for(i=0; i<16; i++){
+    diff |= C[i] ^ Tprime[i];
+}
+return diff ? -1 : 0;}
@@ -0,0 +1,65 @@
+/*
+Written by: Siang Meng Sim
+Email: crypto.s.m.sim@gmail.com
+Date: 25 Feb 2019
+
+Modified in 2026 by FELICS-AE contributors: streaming API.
+*/
+
+#ifndef SUNDAE_H
+#define SUNDAE_H
+
+#include <stdint.h>
+
+#include "gift128.h"
+
+int sundae_enc(const uint8_t* N, unsigned long long Nlen,
+                const uint8_t* A, unsigned long long Alen,
+                const uint8_t* M, unsigned long long Mlen,
+                const uint8_t K[16],
+                uint8_t* C,
+                int outputTag);
+
+int sundae_dec(const uint8_t* N, unsigned long long Nlen,
+                const uint8_t* A, unsigned long long Alen,
+                uint8_t* M,
+                const uint8_t K[16],
+                const uint8_t* C, unsigned long long Clen);
+
+/*
+Streaming API.  SUNDAE is MAC-then-encrypt, so that the message is read
+twice:
+- encryption: sundae_start(), sundae_absorb() the nonce and the associated
+  data, sundae_next(), sundae_absorb() the message, sundae_tag(), then
+  sundae_ofb_start() with the tag and sundae_ofb() the message;
+- decryption: sundae_ofb_start() with the tag and sundae_ofb() the
+  ciphertext, then compute the tag of the message as above and compare.
+Whether the associated data (nonce excluded) and the message are empty must
+be known beforehand.  sundae_absorb() and sundae_ofb() take any number of
+bytes per call.
+*/
+typedef struct {
+    uint32_t rkey[GIFT128_RKEY_WORDS];
+    uint8_t V[16];
+    /* bytes of the current block absorbed in V, or of keystream used */
+    unsigned pos;
+} sundae_ctx;
+
+void sundae_setkey(sundae_ctx* ctx, const uint8_t K[16]);
+
+/* return -1 if Nlen is not 0, 8, 12 or 16 */
+int sundae_start(sundae_ctx* ctx, unsigned Nlen, int hasA, int hasM);
+
+void sundae_absorb(sundae_ctx* ctx, const uint8_t* X, unsigned long long Xlen);
+
+/* end of the nonce and associated data */
+void sundae_next(sundae_ctx* ctx);
+
+/* end of the message */
+void sundae_tag(sundae_ctx* ctx, uint8_t T[16]);
+
+void sundae_ofb_start(sundae_ctx* ctx, const uint8_t T[16]);
+
+void sundae_ofb(sundae_ctx* ctx, uint8_t* out, const uint8_t* in, unsigned long long len);
+
+#endif /* SUNDAE_H */
@@ -0,0 +1 @@
+../../SUNDAE-GIFT-96-128_vref/source/test_vectors.c
\ No newline at end of file
@@ -0,0 +1,137 @@
+/*
+Written in 2026 by FELICS-AE contributors.
+
+Checks the streaming API of sundae.h against sundae_enc() and sundae_dec(),
+feeding the nonce, the associated data and the message in uneven pieces:
+one byte at a time, 15, 16 and 17 bytes at a time, pseudo-random pieces
+(empty ones included), and pieces straddling the nonce and the associated
+data, for every nonce length, with empty and non-empty associated data and
+messages.
+*/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "sundae.h"
+
+#define MAX_LEN 50
+
+/* piece lengths; 0 stands for pseudo-random lengths */
+static const unsigned PIECES[] = {1, 15, 16, 17, 0};
+#define NPIECES (sizeof(PIECES)/sizeof(PIECES[0]))
+
+static uint32_t seed = 1;
+
+static uint8_t random_byte(void){
+    seed = seed*1103515245 + 12345;
+    return (uint8_t)(seed >> 16);
+}
+
+static void random_bytes(uint8_t* X, unsigned len){
+    unsigned i;
+
+    for(i=0; i<len; i++){
+        X[i] = random_byte();
+    }
+}
+
+static unsigned next_piece(unsigned piece, unsigned left){
+    unsigned len = piece ? piece : random_byte() % 20;
+
+    return len < left ? len : left;
+}
+
+static void absorb_pieces(sundae_ctx* ctx, const uint8_t* X, unsigned len, unsigned piece){
+    unsigned n;
+
+    do{
+        n = next_piece(piece, len);
+        sundae_absorb(ctx, X, n);
+        X += n;
+        len -= n;
+    }while(len>0);
+}
+
+static void ofb_pieces(sundae_ctx* ctx, uint8_t* out, const uint8_t* in, unsigned len, unsigned piece){
+    unsigned n;
+
+    do{
+        n = next_piece(piece, len);
+        sundae_ofb(ctx, out, in, n);
+        out += n;
+        in += n;
+        len -= n;
+    }while(len>0);
+}
+
+/* Tag of N || A and M, N || A being absorbed as one input. */
+static void mac_pieces(const uint8_t K[16], const uint8_t* NA, unsigned Nlen, unsigned Alen,
+                const uint8_t* M, unsigned Mlen, unsigned piece, uint8_t T[16]){
+    sundae_ctx ctx;
+
+    sundae_setkey(&ctx, K);
+    sundae_start(&ctx, Nlen, Alen!=0, Mlen!=0);
+    absorb_pieces(&ctx, NA, Nlen+Alen, piece);
+    sundae_next(&ctx);
+    absorb_pieces(&ctx, M, Mlen, piece);
+    sundae_tag(&ctx, T);
+}
+
+static int test(unsigned Nlen, unsigned Alen, unsigned Mlen, unsigned piece){
+    uint8_t K[16], NA[16+MAX_LEN], M[MAX_LEN], C[16+MAX_LEN], D[MAX_LEN], T[16];
+    uint8_t Cs[16+MAX_LEN], Ds[MAX_LEN];
+    sundae_ctx ctx;
+    int errors = 0;
+
+    random_bytes(K, 16);
+    random_bytes(NA, Nlen+Alen);
+    random_bytes(M, Mlen);
+
+    sundae_enc(NA, Nlen, NA+Nlen, Alen, M, Mlen, K, C, 0);
+
+    /* encryption: tag, then OFB over the message */
+    mac_pieces(K, NA, Nlen, Alen, M, Mlen, piece, Cs);
+    sundae_setkey(&ctx, K);
+    sundae_ofb_start(&ctx, Cs);
+    ofb_pieces(&ctx, Cs+16, M, Mlen, piece);
+    if(memcmp(Cs, C, 16+Mlen) != 0){
+        printf("encryption differs (Nlen %u, Alen %u, Mlen %u, pieces %u)\n", Nlen, Alen, Mlen, piece);
+        errors++;
+    }
+
+    /* decryption: OFB over the ciphertext, then tag of the message */
+    if(sundae_dec(NA, Nlen, NA+Nlen, Alen, D, K, C, 16+Mlen) != 0 || memcmp(D, M, Mlen) != 0){
+        printf("sundae_dec fails (Nlen %u, Alen %u, Mlen %u)\n", Nlen, Alen, Mlen);
+        errors++;
+    }
+    sundae_setkey(&ctx, K);
+    sundae_ofb_start(&ctx, C);
+    ofb_pieces(&ctx, Ds, C+16, Mlen, piece);
+    mac_pieces(K, NA, Nlen, Alen, Ds, Mlen, piece, T);
+    if(memcmp(Ds, M, Mlen) != 0 || memcmp(T, C, 16) != 0){
+        printf("decryption differs (Nlen %u, Alen %u, Mlen %u, pieces %u)\n", Nlen, Alen, Mlen, piece);
+        errors++;
+    }
+
+    return errors;
+}
+
+int main(void){
+    static const unsigned NLENS[] = {0, 8, 12, 16};
+    unsigned n, Alen, Mlen, p;
+    int errors = 0;
+
+    for(n=0; n<4; n++){
+        for(Alen=0; Alen<=MAX_LEN-16; Alen++){
+            for(Mlen=0; Mlen<=MAX_LEN; Mlen++){
+                for(p=0; p<NPIECES; p++){
+                    errors += test(NLENS[n], Alen, Mlen, PIECES[p]);
+                }
+            }
+        }
+    }
+
+    printf("%s\n", errors ? "WRONG!" : "CORRECT!");
+    return errors != 0;
+}
@@ -0,0 +1 @@
+../../Saturnin-CTR-Cascade-256_vref/source/api.h
\ No newline at end of file
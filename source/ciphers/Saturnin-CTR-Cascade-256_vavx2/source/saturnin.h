@@ -0,0 +1,59 @@
+/* ======================================================================== */
+/*
+ * Saturnin block cipher, and CTR keystream on 16 blocks with AVX2.
+ */
+
+#ifndef SATURNIN_H
+#define SATURNIN_H
+
+#include <stdint.h>
+
+void saturnin_block_encrypt(int R, int D, const uint8_t *key, uint8_t *buf);
+void saturnin_block_decrypt(int R, int D, const uint8_t *key, uint8_t *buf);
+
+/*
+ * Round constants for R super-rounds and domain D (0 <= R <= 31,
+ * 0 <= D <= 15).
+ */
+void saturnin_round_constants(int R, int D, uint16_t *RC0, uint16_t *RC1);
+
+/*
+ * Number of blocks encrypted together by saturnin_x16_*().
+ */
+#define SATURNIN_X16_BLOCKS   16
+
+/*
+ * Encryption of the CTR input blocks of 16 consecutive counters, in
+ * progress. Word i of the state of block j is x[i][j]: each AVX2
+ * register holds one word of the 16 blocks. The encryption is advanced
+ * one super-round at a time by saturnin_x16_step(), so that the caller
+ * can interleave it with other work (the Cascade chain).
+ *
+ * Callers must check that the processor supports AVX2.
+ */
+typedef struct {
+	uint16_t x[16][SATURNIN_X16_BLOCKS];
+	uint16_t k[16];
+	uint16_t RC0[31], RC1[31];
+	int R, r;
+} saturnin_x16;
+
+/*
+ * Start the encryption with key 'key' of the blocks nonce || 0x80 ||
+ * zeros || counter (32 bits, big-endian), for the counters cc to cc+15.
+ */
+void saturnin_x16_ctr_start(saturnin_x16 *s, int R, int D,
+	const uint8_t *key, const uint8_t *nonce, uint32_t cc);
+
+/*
+ * Run the next super-round, if any.
+ */
+void saturnin_x16_step(saturnin_x16 *s);
+
+/*
+ * Run the remaining super-rounds, and write the 16 encrypted blocks
+ * (512 bytes) to out.
+ */
+void saturnin_x16_finish(saturnin_x16 *s, uint8_t *out);
+
+#endif
@@ -0,0 +1,303 @@
+/* ======================================================================== */
+/*
+ * Saturnin on 16 blocks with AVX2, see saturnin.h.
+ *
+ * The 16-bit words of the state are bitsliced as in saturnin.c, so the
+ * round functions carry over unchanged, with one AVX2 register per word
+ * and one block per 16-bit lane.
+ */
+
+#pragma GCC target("avx2")
+
+#include <string.h>
+#include <stdint.h>
+#include <immintrin.h>
+
+#include "saturnin.h"
+
+#define XOR(a, b)     _mm256_xor_si256((a), (b))
+#define AND(a, b)     _mm256_and_si256((a), (b))
+#define OR(a, b)      _mm256_or_si256((a), (b))
+#define ROTL16(a, n)  OR(_mm256_slli_epi16((a), (n)), _mm256_srli_epi16((a), 16 - (n)))
+#define MASK(m)       _mm256_set1_epi16((short)(m))
+
+/*
+ * sigma_0 on words (i+0, ..., i+3) and sigma_1 on words (i+4, ..., i+7).
+ */
+#define SIGMA(a, b, c, d)   do { \
+		a = XOR(a, AND(b, c)); \
+		b = XOR(b, OR(a, d)); \
+		d = XOR(d, OR(b, c)); \
+		c = XOR(c, AND(b, d)); \
+		b = XOR(b, OR(a, c)); \
+		a = XOR(a, OR(b, d)); \
+	} while (0)
+
+static inline void
+S_box(__m256i *x)
+{
+	int i;
+
+	for (i = 0; i < 16; i += 8) {
+		__m256i a, b, c, d;
+
+		a = x[i + 0]; b = x[i + 1]; c = x[i + 2]; d = x[i + 3];
+		SIGMA(a, b, c, d);
+		x[i + 0] = b; x[i + 1] = c; x[i + 2] = d; x[i + 3] = a;
+
+		a = x[i + 4]; b = x[i + 5]; c = x[i + 6]; d = x[i + 7];
+		SIGMA(a, b, c, d);
+		x[i + 4] = d; x[i + 5] = b; x[i + 6] = a; x[i + 7] = c;
+	}
+}
+
+/*
+ * MUL, as in saturnin.c, on the words (t, t+1, t+2, t+3).
+ */
+#define MUL(x, t)   do { \
+		__m256i mul_tmp = x[t]; \
+		x[t] = x[t + 1]; \
+		x[t + 1] = x[t + 2]; \
+		x[t + 2] = x[t + 3]; \
+		x[t + 3] = XOR(mul_tmp, x[t]); \
+	} while (0)
+
+/*
+ * Words x[d + i] ^= x[s + i] for i = 0 to 3.
+ */
+#define XOR4(x, d, s)   do { \
+		x[d + 0] = XOR(x[d + 0], x[s + 0]); \
+		x[d + 1] = XOR(x[d + 1], x[s + 1]); \
+		x[d + 2] = XOR(x[d + 2], x[s + 2]); \
+		x[d + 3] = XOR(x[d + 3], x[s + 3]); \
+	} while (0)
+
+static inline void
+MDS(__m256i *x)
+{
+	XOR4(x, 8, 12);   /* C ^= D */
+	XOR4(x, 0, 4);    /* A ^= B */
+	MUL(x, 4);        /* B = MUL(B) */
+	MUL(x, 12);       /* D = MUL(D) */
+	XOR4(x, 4, 8);    /* B ^= C */
+	XOR4(x, 12, 0);   /* D ^= A */
+	MUL(x, 0);        /* A = MUL(A) */
+	MUL(x, 0);        /* A = MUL(A) */
+	MUL(x, 8);        /* C = MUL(C) */
+	MUL(x, 8);        /* C = MUL(C) */
+	XOR4(x, 8, 12);   /* C ^= D */
+	XOR4(x, 0, 4);    /* A ^= B */
+	XOR4(x, 4, 8);    /* B ^= C */
+	XOR4(x, 12, 0);   /* D ^= A */
+}
+
+/*
+ * ((x & m) << l) | ((x & ~m) >> r) on the 16-bit words.
+ */
+static inline __m256i
+nibble_rot(__m256i x, uint16_t m, int l, int r)
+{
+	return OR(_mm256_slli_epi16(AND(x, MASK(m)), l),
+		_mm256_srli_epi16(AND(x, MASK(~m)), r));
+}
+
+static inline void
+SR_slice(__m256i *x)
+{
+	int i;
+
+	for (i = 0; i < 4; i ++) {
+		x[ 4 + i] = nibble_rot(x[ 4 + i], 0x7777, 1, 3);
+		x[ 8 + i] = nibble_rot(x[ 8 + i], 0x3333, 2, 2);
+		x[12 + i] = nibble_rot(x[12 + i], 0x1111, 3, 1);
+	}
+}
+
+static inline void
+SR_slice_inv(__m256i *x)
+{
+	int i;
+
+	for (i = 0; i < 4; i ++) {
+		x[ 4 + i] = nibble_rot(x[ 4 + i], 0x1111, 3, 1);
+		x[ 8 + i] = nibble_rot(x[ 8 + i], 0x3333, 2, 2);
+		x[12 + i] = nibble_rot(x[12 + i], 0x7777, 1, 3);
+	}
+}
+
+static inline void
+SR_sheet(__m256i *x)
+{
+	int i;
+
+	for (i = 0; i < 4; i ++) {
+		x[ 4 + i] = ROTL16(x[ 4 + i],  4);
+		x[ 8 + i] = ROTL16(x[ 8 + i],  8);
+		x[12 + i] = ROTL16(x[12 + i], 12);
+	}
+}
+
+static inline void
+SR_sheet_inv(__m256i *x)
+{
+	int i;
+
+	for (i = 0; i < 4; i ++) {
+		x[ 4 + i] = ROTL16(x[ 4 + i], 12);
+		x[ 8 + i] = ROTL16(x[ 8 + i],  8);
+		x[12 + i] = ROTL16(x[12 + i],  4);
+	}
+}
+
+/*
+ * Transpose the 16x16 matrix of 16-bit words in x: word i of block j
+ * becomes word j of register i, i.e. x[j] is then block j.
+ */
+static void
+transpose(__m256i *x)
+{
+	__m256i a[16], b[16];
+	int i, j;
+
+	for (i = 0; i < 16; i += 2) {
+		a[i + 0] = _mm256_unpacklo_epi16(x[i], x[i + 1]);
+		a[i + 1] = _mm256_unpackhi_epi16(x[i], x[i + 1]);
+	}
+	for (i = 0; i < 16; i += 4) {
+		b[i + 0] = _mm256_unpacklo_epi32(a[i + 0], a[i + 2]);
+		b[i + 1] = _mm256_unpackhi_epi32(a[i + 0], a[i + 2]);
+		b[i + 2] = _mm256_unpacklo_epi32(a[i + 1], a[i + 3]);
+		b[i + 3] = _mm256_unpackhi_epi32(a[i + 1], a[i + 3]);
+	}
+	for (i = 0; i < 16; i += 8) {
+		for (j = 0; j < 4; j ++) {
+			a[i + 2 * j + 0] = _mm256_unpacklo_epi64(b[i + j], b[i + j + 4]);
+			a[i + 2 * j + 1] = _mm256_unpackhi_epi64(b[i + j], b[i + j + 4]);
+		}
+	}
+	for (i = 0; i < 8; i ++) {
+		x[i + 0] = _mm256_permute2x128_si256(a[i], a[i + 8], 0x20);
+		x[i + 8] = _mm256_permute2x128_si256(a[i], a[i + 8], 0x31);
+	}
+}
+
+void
+saturnin_x16_ctr_start(saturnin_x16 *s, int R, int D,
+	const uint8_t *key, const uint8_t *nonce, uint32_t cc)
+{
+	uint8_t t[32];
+	int i, j;
+
+	memcpy(t, nonce, 16);
+	t[16] = 0x80;
+	memset(t + 17, 0, 15);
+	for (i = 0; i < 16; i ++) {
+		s->k[i] = key[i << 1] + ((uint16_t)key[(i << 1) + 1] << 8);
+		for (j = 0; j < SATURNIN_X16_BLOCKS; j ++) {
+			s->x[i][j] = (t[i << 1] + ((uint16_t)t[(i << 1) + 1] << 8))
+				^ s->k[i];
+		}
+	}
+	for (j = 0; j < SATURNIN_X16_BLOCKS; j ++) {
+		uint32_t c = cc + (uint32_t)j;
+
+		/* bytes 28 to 31, big-endian counter */
+		s->x[14][j] ^= (uint16_t)(((c >> 24) & 0xFF) | (((c >> 16) & 0xFF) << 8));
+		s->x[15][j] ^= (uint16_t)(((c >> 8) & 0xFF) | ((c & 0xFF) << 8));
+	}
+	saturnin_round_constants(R, D, s->RC0, s->RC1);
+	s->R = R;
+	s->r = 0;
+}
+
+/*
+ * Super-round i on the state x, as in saturnin_block_encrypt().
+ */
+static void
+super_round(__m256i *x, const saturnin_x16 *s, int i)
+{
+	int j;
+
+	/*
+	 * Even round.
+	 */
+	S_box(x);
+	MDS(x);
+
+	/*
+	 * Odd round.
+	 */
+	S_box(x);
+	if ((i & 1) == 0) {
+		SR_slice(x);
+		MDS(x);
+		SR_slice_inv(x);
+		x[0] = XOR(x[0], MASK(s->RC0[i]));
+		x[8] = XOR(x[8], MASK(s->RC1[i]));
+		for (j = 0; j < 16; j ++) {
+			x[j] = XOR(x[j], MASK((uint16_t)((s->k[j] << 11) | (s->k[j] >> 5))));
+		}
+	} else {
+		SR_sheet(x);
+		MDS(x);
+		SR_sheet_inv(x);
+		x[0] = XOR(x[0], MASK(s->RC0[i]));
+		x[8] = XOR(x[8], MASK(s->RC1[i]));
+		for (j = 0; j < 16; j ++) {
+			x[j] = XOR(x[j], MASK(s->k[j]));
+		}
+	}
+}
+
+static void
+load(__m256i *x, const saturnin_x16 *s)
+{
+	int i;
+
+	for (i = 0; i < 16; i ++) {
+		x[i] = _mm256_loadu_si256((const __m256i *)s->x[i]);
+	}
+}
+
+static void
+store(saturnin_x16 *s, const __m256i *x)
+{
+	int i;
+
+	for (i = 0; i < 16; i ++) {
+		_mm256_storeu_si256((__m256i *)s->x[i], x[i]);
+	}
+}
+
+void
+saturnin_x16_step(saturnin_x16 *s)
+{
+	__m256i x[16];
+
+	if (s->r >= s->R) {
+		return;
+	}
+	load(x, s);
+	super_round(x, s, s->r ++);
+	store(s, x);
+}
+
+void
+saturnin_x16_finish(saturnin_x16 *s, uint8_t *out)
+{
+	__m256i x[16];
+	int i;
+
+	load(x, s);
+	for (; s->r < s->R; s->r ++) {
+		super_round(x, s, s->r);
+	}
+
+	/*
+	 * Words are little-endian, as are the lanes.
+	 */
+	transpose(x);
+	for (i = 0; i < SATURNIN_X16_BLOCKS; i ++) {
+		_mm256_storeu_si256((__m256i *)(out + 32 * i), x[i]);
+	}
+}
@@ -0,0 +1 @@
+../../Saturnin-CTR-Cascade-256_vref/source/test_vectors.c
\ No newline at end of file
@@ -0,0 +1 @@
+../../Schwaemm256-128_vopt/source/api.h
\ No newline at end of file
@@ -0,0 +1 @@
+../../Schwaemm256-128_vopt/source/encrypt.c
\ No newline at end of file
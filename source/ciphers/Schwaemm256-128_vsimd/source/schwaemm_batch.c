@@ -0,0 +1,317 @@
+/*
+  Batch Schwaemm256-128 with AVX2, see schwaemm_batch.h.
+
+  State word w of instance i is lane i of s[w], in the order of
+  encrypt.c (x0, y0, ..., x5, y5); the steps follow sparkle_opt.c and
+  the rho and rate-whitening functions those of encrypt.c.
+*/
+
+#pragma GCC target("avx2")
+
+#include <string.h>
+#include <stdint.h>
+#include <immintrin.h>
+
+#include "schwaemm_cfg.h"
+#include "schwaemm_batch.h"
+
+
+#define LANES           8
+
+#define STATE_BRANS     (SPARKLE_STATE/64)
+#define STATE_WORDS     (SPARKLE_STATE/32)
+#define RATE_WORDS      (SPARKLE_RATE/32)
+#define RATE_BYTES      (SPARKLE_RATE/8)
+#define CAP_BRANS       (SPARKLE_CAPACITY/64)
+#define CAP_WORDS       (SPARKLE_CAPACITY/32)
+#define KEY_WORDS       (SCHWAEMM_KEY_LEN/32)
+#define NONCE_WORDS     (SCHWAEMM_NONCE_LEN/32)
+#define TAG_WORDS       (SCHWAEMM_TAG_LEN/32)
+#define TAG_BYTES       (SCHWAEMM_TAG_LEN/8)
+
+#define CONST_A0 (((uint32_t) (0 ^ (1 << CAP_BRANS))) << 24)
+#define CONST_A1 (((uint32_t) (1 ^ (1 << CAP_BRANS))) << 24)
+#define CONST_M2 (((uint32_t) (2 ^ (1 << CAP_BRANS))) << 24)
+#define CONST_M3 (((uint32_t) (3 ^ (1 << CAP_BRANS))) << 24)
+
+#define CAP_INDEX(i)    ((i) & (CAP_WORDS-1))
+
+#define VXOR(a, b)      _mm256_xor_si256((a), (b))
+#define VADD(a, b)      _mm256_add_epi32((a), (b))
+#define VROT(x, n)      _mm256_or_si256(_mm256_srli_epi32((x), (n)), _mm256_slli_epi32((x), 32-(n)))
+#define VSET1(c)        _mm256_set1_epi32((int) (c))
+#define VELL(x)         VROT(VXOR((x), _mm256_slli_epi32((x), 16)), 16)
+
+
+static const uint32_t RCON[8] = {
+    0xB7E15162, 0xBF715880, 0x38B4DA56, 0x324E7738,
+    0xBB1185EB, 0x4F7C7B57, 0xCFBFA1C8, 0xC2B3293D
+};
+
+
+// as sparkle_opt(s, STATE_BRANS, steps)
+static void sparkle_x8(__m256i s[STATE_WORDS], int steps)
+{
+    int i, j;
+
+    for (i = 0; i < steps; i++)
+    {
+        __m256i tmpx, tmpy, x0, y0;
+
+        // Add round constant
+        s[1] = VXOR(s[1], VSET1(RCON[i%8]));
+        s[3] = VXOR(s[3], VSET1(i));
+        // ARXBOX layer
+        for (j = 0; j < 2*STATE_BRANS; j += 2)
+        {
+            const __m256i rc = VSET1(RCON[j>>1]);
+            __m256i x = s[j], y = s[j+1];
+
+            x = VADD(x, VROT(y, 31)); y = VXOR(y, VROT(x, 24)); x = VXOR(x, rc);
+            x = VADD(x, VROT(y, 17)); y = VXOR(y, VROT(x, 17)); x = VXOR(x, rc);
+            x = VADD(x, y);           y = VXOR(y, VROT(x, 31)); x = VXOR(x, rc);
+            x = VADD(x, VROT(y, 24)); y = VXOR(y, VROT(x, 16)); x = VXOR(x, rc);
+            s[j] = x; s[j+1] = y;
+        }
+        // Linear layer
+        tmpx = x0 = s[0];
+        tmpy = y0 = s[1];
+        for (j = 2; j < STATE_BRANS; j += 2)
+        {
+            tmpx = VXOR(tmpx, s[j]);
+            tmpy = VXOR(tmpy, s[j+1]);
+        }
+        tmpx = VELL(tmpx);
+        tmpy = VELL(tmpy);
+        for (j = 2; j < STATE_BRANS; j += 2)
+        {
+            s[j-2] = VXOR(VXOR(s[j+STATE_BRANS], s[j]), tmpy);
+            s[j+STATE_BRANS] = s[j];
+            s[j-1] = VXOR(VXOR(s[j+STATE_BRANS+1], s[j+1]), tmpx);
+            s[j+STATE_BRANS+1] = s[j+1];
+        }
+        s[STATE_BRANS-2] = VXOR(VXOR(s[STATE_BRANS], x0), tmpy);
+        s[STATE_BRANS] = x0;
+        s[STATE_BRANS-1] = VXOR(VXOR(s[STATE_BRANS+1], y0), tmpx);
+        s[STATE_BRANS+1] = y0;
+    }
+}
+
+
+static inline uint32_t load32(const uint8_t *p)
+{
+    uint32_t w;
+    memcpy(&w, p, 4);
+    return w;
+}
+
+
+// gather words w0 to w0+n-1 of the blocks p[i] + off, into v[w0..]
+static void load_words(__m256i *v, int w0, int n, const uint8_t *const p[LANES], size_t off)
+{
+    int w;
+
+    for (w = w0; w < w0 + n; w++)
+        v[w] = _mm256_setr_epi32(
+            (int) load32(p[0] + off + 4*w), (int) load32(p[1] + off + 4*w),
+            (int) load32(p[2] + off + 4*w), (int) load32(p[3] + off + 4*w),
+            (int) load32(p[4] + off + 4*w), (int) load32(p[5] + off + 4*w),
+            (int) load32(p[6] + off + 4*w), (int) load32(p[7] + off + 4*w));
+}
+
+
+// scatter words 0 to n-1 of v to the blocks p[i] + off
+static void store_words(uint8_t *const p[LANES], size_t off, const __m256i *v, int n)
+{
+    uint32_t t[LANES];
+    int w, i;
+
+    for (w = 0; w < n; w++)
+    {
+        _mm256_storeu_si256((__m256i *) t, v[w]);
+        for (i = 0; i < LANES; i++)
+            memcpy(p[i] + off + 4*w, &t[i], 4);
+    }
+}
+
+
+// copy the last inlen (1 to RATE_BYTES) bytes of each in[i] + off to
+// buf[i], padded with pad[i] (or zeros) and 0x80 as in encrypt.c
+static void pad_last(uint8_t buf[LANES][RATE_BYTES], const uint8_t *const in[LANES], size_t off, size_t inlen, const uint8_t (*pad)[RATE_BYTES])
+{
+    int i;
+
+    for (i = 0; i < LANES; i++)
+    {
+        memcpy(buf[i], in[i] + off, inlen);
+        if (inlen < RATE_BYTES)
+        {
+            if (pad)
+                memcpy(buf[i] + inlen, pad[i] + inlen, RATE_BYTES - inlen);
+            else
+                memset(buf[i] + inlen, 0, RATE_BYTES - inlen);
+            buf[i][inlen] ^= 0x80;
+        }
+    }
+}
+
+
+// combined rho and rate-whitening on the RATE_WORDS words of in; the
+// keystream words (state before rho) go to out when it is not NULL
+static void rho_whi(__m256i s[STATE_WORDS], const __m256i *in, __m256i *out, int decrypt)
+{
+    int i, j;
+
+    for (i = 0, j = RATE_WORDS/2; i < RATE_WORDS/2; i++, j++)
+    {
+        __m256i tmp1 = s[i], tmp2 = s[j];
+
+        if (decrypt)
+        {
+            s[i] = VXOR(s[i], VXOR(VXOR(s[j], in[i]), s[RATE_WORDS+i]));
+            s[j] = VXOR(VXOR(tmp1, in[j]), s[RATE_WORDS+CAP_INDEX(j)]);
+        }
+        else
+        {
+            s[i] = VXOR(VXOR(s[j], in[i]), s[RATE_WORDS+i]);
+            s[j] = VXOR(s[j], VXOR(VXOR(tmp1, in[j]), s[RATE_WORDS+CAP_INDEX(j)]));
+        }
+        if (out)
+        {
+            out[i] = VXOR(in[i], tmp1);
+            out[j] = VXOR(in[j], tmp2);
+        }
+    }
+}
+
+
+static void initialize(__m256i s[STATE_WORDS], const uint8_t *const npub[LANES], const uint8_t *const k[LANES])
+{
+    load_words(s, 0, NONCE_WORDS, npub, 0);
+    load_words(s + RATE_WORDS, 0, KEY_WORDS, k, 0);
+    sparkle_x8(s, SPARKLE_STEPS_BIG);
+}
+
+
+static void process_ad(__m256i s[STATE_WORDS], const uint8_t *const ad[LANES], size_t adlen)
+{
+    __m256i in[RATE_WORDS];
+    uint8_t buf[LANES][RATE_BYTES];
+    const uint8_t *bufp[LANES];
+    size_t off = 0;
+    int i;
+
+    for (; adlen - off > RATE_BYTES; off += RATE_BYTES)
+    {
+        load_words(in, 0, RATE_WORDS, ad, off);
+        rho_whi(s, in, NULL, 0);
+        sparkle_x8(s, SPARKLE_STEPS_SLIM);
+    }
+
+    s[STATE_WORDS-1] = VXOR(s[STATE_WORDS-1], VSET1((adlen - off < RATE_BYTES) ? CONST_A0 : CONST_A1));
+    pad_last(buf, ad, off, adlen - off, NULL);
+    for (i = 0; i < LANES; i++) bufp[i] = buf[i];
+    load_words(in, 0, RATE_WORDS, bufp, 0);
+    rho_whi(s, in, NULL, 0);
+    sparkle_x8(s, SPARKLE_STEPS_BIG);
+}
+
+
+// encrypt (decrypt) len > 0 bytes of in[i] to out[i]
+static void process_text(__m256i s[STATE_WORDS], uint8_t *const out[LANES], const uint8_t *const in[LANES], size_t len, int decrypt)
+{
+    __m256i win[RATE_WORDS], wout[RATE_WORDS];
+    uint8_t buf[LANES][RATE_BYTES], rate[LANES][RATE_BYTES];
+    const uint8_t *bufp[LANES];
+    uint8_t *ratep[LANES];
+    size_t off = 0, last;
+    int i;
+
+    for (; len - off > RATE_BYTES; off += RATE_BYTES)
+    {
+        load_words(win, 0, RATE_WORDS, in, off);
+        rho_whi(s, win, wout, decrypt);
+        store_words(out, off, wout, RATE_WORDS);
+        sparkle_x8(s, SPARKLE_STEPS_SLIM);
+    }
+
+    last = len - off;
+    s[STATE_WORDS-1] = VXOR(s[STATE_WORDS-1], VSET1((last < RATE_BYTES) ? CONST_M2 : CONST_M3));
+    for (i = 0; i < LANES; i++)
+    {
+        bufp[i] = buf[i];
+        ratep[i] = rate[i];
+    }
+    if (decrypt)
+    {
+        // the padding of the last ciphertext block is taken from the rate
+        store_words(ratep, 0, s, RATE_WORDS);
+        pad_last(buf, in, off, last, (const uint8_t (*)[RATE_BYTES]) rate);
+    }
+    else
+        pad_last(buf, in, off, last, NULL);
+    load_words(win, 0, RATE_WORDS, bufp, 0);
+    rho_whi(s, win, wout, decrypt);
+    store_words(ratep, 0, wout, RATE_WORDS);
+    for (i = 0; i < LANES; i++)
+        memcpy(out[i] + off, rate[i], last);
+    sparkle_x8(s, SPARKLE_STEPS_BIG);
+}
+
+
+static void finalize(__m256i s[STATE_WORDS], const uint8_t *const k[LANES])
+{
+    __m256i key[KEY_WORDS];
+    int i;
+
+    load_words(key, 0, KEY_WORDS, k, 0);
+    for (i = 0; i < KEY_WORDS; i++)
+        s[RATE_WORDS+i] = VXOR(s[RATE_WORDS+i], key[i]);
+}
+
+
+void schwaemm256_128_x8_encrypt(
+    uint8_t *const c[8],
+    const uint8_t *const m[8], size_t mlen,
+    const uint8_t *const ad[8], size_t adlen,
+    const uint8_t *const npub[8],
+    const uint8_t *const k[8]
+    )
+{
+    __m256i s[STATE_WORDS];
+
+    initialize(s, npub, k);
+    if (adlen) process_ad(s, ad, adlen);
+    if (mlen) process_text(s, c, m, mlen, 0);
+    finalize(s, k);
+    store_words(c, mlen, s + RATE_WORDS, TAG_WORDS);
+}
+
+
+int schwaemm256_128_x8_decrypt(
+    uint8_t *const m[8],
+    const uint8_t *const c[8], size_t clen,
+    const uint8_t *const ad[8], size_t adlen,
+    const uint8_t *const npub[8],
+    const uint8_t *const k[8]
+    )
+{
+    __m256i s[STATE_WORDS], tag[TAG_WORDS], diff;
+    size_t mlen;
+    int i;
+
+    if (clen < TAG_BYTES) return (1 << LANES) - 1;
+    mlen = clen - TAG_BYTES;
+
+    initialize(s, npub, k);
+    if (adlen) process_ad(s, ad, adlen);
+    if (mlen) process_text(s, m, c, mlen, 1);
+    finalize(s, k);
+
+    load_words(tag, 0, TAG_WORDS, c, mlen);
+    diff = _mm256_setzero_si256();
+    for (i = 0; i < TAG_WORDS; i++)
+        diff = _mm256_or_si256(diff, VXOR(s[RATE_WORDS+i], tag[i]));
+    // lanes with a nonzero difference
+    return 0xff & ~_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(diff, _mm256_setzero_si256())));
+}
@@ -0,0 +1,41 @@
+#ifndef SCHWAEMM_BATCH_H
+#define SCHWAEMM_BATCH_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+
+/*
+  Eight independent Schwaemm256-128 instances processed together, one
+  instance per 32-bit lane of AVX2 registers (the 12 state words of
+  SPARKLE384 are 12 registers).  All the messages of a batch have the
+  same length, as well as their associated data; keys and nonces are per
+  instance.
+
+  Not used by crypto_aead_encrypt/crypto_aead_decrypt, which only ever
+  have one instance; meant for processing packets in batches.  Callers
+  must check that the processor supports AVX2.  The test folder checks
+  every instance against crypto_aead_encrypt/crypto_aead_decrypt.
+*/
+
+
+// encrypt mlen bytes of each m[i] into c[i], followed by its 16-byte tag
+void schwaemm256_128_x8_encrypt(
+    uint8_t *const c[8],
+    const uint8_t *const m[8], size_t mlen,
+    const uint8_t *const ad[8], size_t adlen,
+    const uint8_t *const npub[8],
+    const uint8_t *const k[8]
+    );
+
+// decrypt clen bytes of each c[i] (tag included) into m[i];
+// return the mask of the instances whose tag is wrong (0 if all are right)
+int schwaemm256_128_x8_decrypt(
+    uint8_t *const m[8],
+    const uint8_t *const c[8], size_t clen,
+    const uint8_t *const ad[8], size_t adlen,
+    const uint8_t *const npub[8],
+    const uint8_t *const k[8]
+    );
+
+#endif /* SCHWAEMM_BATCH_H */
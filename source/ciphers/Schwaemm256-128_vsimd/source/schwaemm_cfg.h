@@ -0,0 +1 @@
+../../Schwaemm256-128_vopt/source/schwaemm_cfg.h
\ No newline at end of file
@@ -0,0 +1,204 @@
+///////////////////////////////////////////////////////////////////////////////
+// sparkle_opt.c: Optimized C99 implementation of the SPARKLE permutation.   //
+// This file is part of the SPARKLE submission to NIST's LW Crypto Project.  //
+// Version 1.1.2 (2020-10-30), see <http://www.cryptolux.org/> for updates.  //
+// Authors: The SPARKLE Group (C. Beierle, A. Biryukov, L. Cardoso dos       //
+// Santos, J. Groszschaedl, L. Perrin, A. Udovenko, V. Velichkov, Q. Wang).  //
+// License: GPLv3 (see LICENSE file), other licenses available upon request. //
+// Copyright (C) 2019-2020 University of Luxembourg <http://www.uni.lu/>.    //
+// ------------------------------------------------------------------------- //
+// This program is free software: you can redistribute it and/or modify it   //
+// under the terms of the GNU General Public License as published by the     //
+// Free Software Foundation, either version 3 of the License, or (at your    //
+// option) any later version. This program is distributed in the hope that   //
+// it will be useful, but WITHOUT ANY WARRANTY; without even the implied     //
+// warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the  //
+// GNU General Public License for more details. You should have received a   //
+// copy of the GNU General Public License along with this program. If not,   //
+// see <http://www.gnu.org/licenses/>.                                       //
+// ------------------------------------------------------------------------- //
+// Modified in 2026 by FELICS-AE contributors: on x86-64 processors with     //
+// AVX2, the x (resp. y) words of the six branches of SPARKLE384 are kept in //
+// lanes 0 to 5 of one register, so that the six Alzette boxes of a step run //
+// together, and the linear layer is done with lane permutations.            //
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include <stdio.h>
+#include "sparkle_opt.h"
+
+
+#define ROT(x, n) (((x) >> (n)) | ((x) << (32-(n))))
+#define ELL(x) (ROT(((x) ^ ((x) << 16)), 16))
+
+
+// Round constants
+static const uint32_t RCON[MAX_BRANCHES] = {      \
+  0xB7E15162, 0xBF715880, 0x38B4DA56, 0x324E7738, \
+  0xBB1185EB, 0x4F7C7B57, 0xCFBFA1C8, 0xC2B3293D  \
+};
+
+
+static void sparkle_scalar(uint32_t *state, int brans, int steps)
+{
+  int i, j;  // Step and branch counter
+  uint32_t rc, tmpx, tmpy, x0, y0;
+  
+  for(i = 0; i < steps; i ++) {
+    // Add round constant
+    state[1] ^= RCON[i%MAX_BRANCHES];
+    state[3] ^= i;
+    // ARXBOX layer
+    for(j = 0; j < 2*brans; j += 2) {
+      rc = RCON[j>>1];
+      state[j] += ROT(state[j+1], 31);
+      state[j+1] ^= ROT(state[j], 24);
+      state[j] ^= rc;
+      state[j] += ROT(state[j+1], 17);
+      state[j+1] ^= ROT(state[j], 17);
+      state[j] ^= rc;
+      state[j] += state[j+1];
+      state[j+1] ^= ROT(state[j], 31);
+      state[j] ^= rc;
+      state[j] += ROT(state[j+1], 24);
+      state[j+1] ^= ROT(state[j], 16);
+      state[j] ^= rc;
+    }
+    // Linear layer
+    tmpx = x0 = state[0];
+    tmpy = y0 = state[1];
+    for(j = 2; j < brans; j += 2) {
+      tmpx ^= state[j];
+      tmpy ^= state[j+1];
+    }
+    tmpx = ELL(tmpx);
+    tmpy = ELL(tmpy);
+    for (j = 2; j < brans; j += 2) {
+      state[j-2] = state[j+brans] ^ state[j] ^ tmpy;
+      state[j+brans] = state[j];
+      state[j-1] = state[j+brans+1] ^ state[j+1] ^ tmpx;
+      state[j+brans+1] = state[j+1];
+    }
+    state[brans-2] = state[brans] ^ x0 ^ tmpy;
+    state[brans] = x0;
+    state[brans-1] = state[brans+1] ^ y0 ^ tmpx;
+    state[brans+1] = y0;
+  }
+}
+
+
+#if defined(__x86_64__) && defined(__GNUC__)
+
+#include <immintrin.h>
+
+#define SPARKLE_AVX2 1
+
+#define VAVX2 __attribute__((always_inline, target("avx2")))
+
+// Right rotations of the 32-bit lanes, by bytes with vpshufb
+#define VROT(x, n) _mm256_or_si256(_mm256_srli_epi32((x), (n)), \
+                                   _mm256_slli_epi32((x), 32-(n)))
+#define VROT16(x) _mm256_shuffle_epi8((x), _mm256_setr_epi8( \
+  2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13,      \
+  2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13))
+#define VROT24(x) _mm256_shuffle_epi8((x), _mm256_setr_epi8( \
+  3, 0, 1, 2, 7, 4, 5, 6, 11, 8, 9, 10, 15, 12, 13, 14,      \
+  3, 0, 1, 2, 7, 4, 5, 6, 11, 8, 9, 10, 15, 12, 13, 14))
+#define VELL(x) VROT16(_mm256_xor_si256((x), _mm256_slli_epi32((x), 16)))
+
+#define LANES(a, b, c, d, e, f, g, h) _mm256_setr_epi32(a, b, c, d, e, f, g, h)
+
+// Alzette on the (x, y) lanes, with constants rc
+static inline VAVX2 void alzette_avx2(__m256i *x, __m256i *y, __m256i rc)
+{
+  *x = _mm256_add_epi32(*x, VROT(*y, 31));
+  *y = _mm256_xor_si256(*y, VROT24(*x));
+  *x = _mm256_xor_si256(*x, rc);
+  *x = _mm256_add_epi32(*x, VROT(*y, 17));
+  *y = _mm256_xor_si256(*y, VROT(*x, 17));
+  *x = _mm256_xor_si256(*x, rc);
+  *x = _mm256_add_epi32(*x, *y);
+  *y = _mm256_xor_si256(*y, VROT(*x, 31));
+  *x = _mm256_xor_si256(*x, rc);
+  *x = _mm256_add_epi32(*x, VROT24(*y));
+  *y = _mm256_xor_si256(*y, VROT16(*x));
+  *x = _mm256_xor_si256(*x, rc);
+}
+
+// ELL of the XOR of lanes 0 to 2 of v, in lanes 0 to 2 (0 elsewhere)
+static inline VAVX2 __m256i ell_sum_avx2(__m256i v)
+{
+  const __m256i rot1 = LANES(1, 2, 0, 3, 4, 5, 6, 7);
+  const __m256i rot2 = LANES(2, 0, 1, 3, 4, 5, 6, 7);
+  const __m256i low3 = LANES(-1, -1, -1, 0, 0, 0, 0, 0);
+  __m256i s;
+
+  s = _mm256_xor_si256(v, _mm256_permutevar8x32_epi32(v, rot1));
+  s = _mm256_xor_si256(s, _mm256_permutevar8x32_epi32(v, rot2));
+  return _mm256_and_si256(VELL(s), low3);
+}
+
+// Feistel linear layer of SPARKLE384 on the lanes of v, with t from
+// ell_sum_avx2() on the other half of the branches: the new left branches
+// are right[b+1] ^ left[b+1] ^ t (b+1 mod 3), the new right ones left[b]
+static inline VAVX2 __m256i linear_avx2(__m256i v, __m256i t)
+{
+  const __m256i swap = LANES(3, 4, 5, 0, 1, 2, 6, 7);
+  const __m256i feis = LANES(4, 5, 3, 0, 1, 2, 6, 7);
+  __m256i u;
+
+  // lanes 3 to 5: right[b] ^ left[b]
+  u = _mm256_xor_si256(v, _mm256_permutevar8x32_epi32(v, swap));
+  u = _mm256_blend_epi32(v, u, 0x38);
+  return _mm256_xor_si256(_mm256_permutevar8x32_epi32(u, feis), t);
+}
+
+__attribute__((target("avx2"))) static void sparkle384_avx2(uint32_t *state,
+  int steps)
+{
+  const __m256i rc = LANES(RCON[0], RCON[1], RCON[2], RCON[3], RCON[4], \
+                           RCON[5], 0, 0);
+  uint32_t xs[8] = { 0 }, ys[8] = { 0 };
+  __m256i x, y, tx, ty;
+  int i;
+
+  for (i = 0; i < 6; i++) {
+    xs[i] = state[2*i];
+    ys[i] = state[2*i+1];
+  }
+  x = _mm256_loadu_si256((const __m256i *) xs);
+  y = _mm256_loadu_si256((const __m256i *) ys);
+
+  for (i = 0; i < steps; i++) {
+    // Add round constant
+    y = _mm256_xor_si256(y, LANES(RCON[i%MAX_BRANCHES], i, 0, 0, 0, 0, 0, 0));
+    // ARXBOX layer
+    alzette_avx2(&x, &y, rc);
+    // Linear layer
+    tx = ell_sum_avx2(x);
+    ty = ell_sum_avx2(y);
+    x = linear_avx2(x, ty);
+    y = linear_avx2(y, tx);
+  }
+
+  _mm256_storeu_si256((__m256i *) xs, x);
+  _mm256_storeu_si256((__m256i *) ys, y);
+  for (i = 0; i < 6; i++) {
+    state[2*i] = xs[i];
+    state[2*i+1] = ys[i];
+  }
+}
+
+#endif  // __x86_64__ && __GNUC__
+
+
+void sparkle_opt(uint32_t *state, int brans, int steps)
+{
+#ifdef SPARKLE_AVX2
+  if (brans == 6 && __builtin_cpu_supports("avx2")) {
+    sparkle384_avx2(state, steps);
+    return;
+  }
+#endif
+  sparkle_scalar(state, brans, steps);
+}
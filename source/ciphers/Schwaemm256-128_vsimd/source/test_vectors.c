@@ -0,0 +1 @@
+../../Schwaemm256-128_vref/source/test_vectors.c
\ No newline at end of file
@@ -0,0 +1,121 @@
+/*
+  Checks every instance of the batch Schwaemm256-128 (schwaemm_batch.h)
+  against crypto_aead_encrypt and crypto_aead_decrypt, for all lengths of
+  associated data and message up to a little over two rate blocks, with
+  distinct keys, nonces and contents per instance.
+*/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "api.h"
+#include "crypto_aead.h"
+#include "schwaemm_batch.h"
+
+
+#define LANES       8
+#define MAX_LEN     70
+
+
+static uint32_t seed = 1;
+
+static void random_bytes(uint8_t *p, size_t len)
+{
+    size_t i;
+
+    for (i = 0; i < len; i++)
+    {
+        seed = seed * 1103515245 + 12345;
+        p[i] = (uint8_t)(seed >> 16);
+    }
+}
+
+
+// run one batch and compare each instance with the one-instance API;
+// return the number of mismatches
+static int test_batch(size_t adlen, size_t mlen)
+{
+    uint8_t k[LANES][CRYPTO_KEYBYTES], n[LANES][CRYPTO_NPUBBYTES];
+    uint8_t ad[LANES][MAX_LEN + 1], m[LANES][MAX_LEN + 1];
+    uint8_t c[LANES][MAX_LEN + CRYPTO_ABYTES], d[LANES][MAX_LEN + 1];
+    uint8_t expected[MAX_LEN + CRYPTO_ABYTES], decrypted[MAX_LEN + 1];
+    const uint8_t *kp[LANES], *np[LANES], *adp[LANES], *mp[LANES], *cp[LANES];
+    uint8_t *co[LANES], *dout[LANES];
+    size_t clen, dlen;
+    int i, wrong, errors = 0;
+
+    for (i = 0; i < LANES; i++)
+    {
+        random_bytes(k[i], CRYPTO_KEYBYTES);
+        random_bytes(n[i], CRYPTO_NPUBBYTES);
+        random_bytes(ad[i], adlen);
+        random_bytes(m[i], mlen);
+        kp[i] = k[i]; np[i] = n[i]; adp[i] = ad[i]; mp[i] = m[i];
+        co[i] = c[i]; cp[i] = c[i]; dout[i] = d[i];
+    }
+
+    schwaemm256_128_x8_encrypt(co, mp, mlen, adp, adlen, np, kp);
+
+    for (i = 0; i < LANES; i++)
+    {
+        crypto_aead_encrypt(expected, &clen, m[i], mlen, ad[i], adlen, n[i], k[i]);
+        if (clen != mlen + CRYPTO_ABYTES || memcmp(c[i], expected, clen) != 0)
+        {
+            printf("instance %d encrypts wrongly (adlen %zu, mlen %zu)\n", i, adlen, mlen);
+            errors++;
+        }
+        if (crypto_aead_decrypt(decrypted, &dlen, c[i], mlen + CRYPTO_ABYTES, ad[i], adlen, n[i], k[i]) != 0
+            || dlen != mlen || memcmp(decrypted, m[i], mlen) != 0)
+        {
+            printf("instance %d does not decrypt with crypto_aead_decrypt (adlen %zu, mlen %zu)\n", i, adlen, mlen);
+            errors++;
+        }
+    }
+
+    wrong = schwaemm256_128_x8_decrypt(dout, cp, mlen + CRYPTO_ABYTES, adp, adlen, np, kp);
+    for (i = 0; i < LANES; i++)
+    {
+        if ((wrong >> i) & 1 || memcmp(d[i], m[i], mlen) != 0)
+        {
+            printf("instance %d decrypts wrongly (adlen %zu, mlen %zu)\n", i, adlen, mlen);
+            errors++;
+        }
+    }
+
+    // a forged tag in one instance must be reported for that instance only
+    i = (int)((adlen + mlen) % LANES);
+    c[i][mlen + mlen % CRYPTO_ABYTES] ^= 0x01;
+    wrong = schwaemm256_128_x8_decrypt(dout, cp, mlen + CRYPTO_ABYTES, adp, adlen, np, kp);
+    if (wrong != 1 << i)
+    {
+        printf("forgery in instance %d reported as 0x%x (adlen %zu, mlen %zu)\n", i, wrong, adlen, mlen);
+        errors++;
+    }
+
+    return errors;
+}
+
+
+int main(void)
+{
+    size_t adlen, mlen;
+    int errors = 0;
+
+    if (!__builtin_cpu_supports("avx2"))
+    {
+        printf("skipped, AVX2 is not supported\n");
+        return 0;
+    }
+
+    for (adlen = 0; adlen <= MAX_LEN; adlen++)
+    {
+        for (mlen = 0; mlen <= MAX_LEN; mlen++)
+        {
+            errors += test_batch(adlen, mlen);
+        }
+    }
+
+    printf("%s\n", errors ? "WRONG!" : "CORRECT!");
+    return errors != 0;
+}
@@ -0,0 +1 @@
+../../Subterranean-SAE-128_vref/source/api.h
\ No newline at end of file
@@ -0,0 +1,26 @@
+/*
+  Modified in 2026 by FELICS-AE contributors: calls the bit-packed
+  subterranean_packed.c, with lengths in bytes.
+*/
+
+#include <stdint.h>
+#include "subterranean_packed.h"
+#include "api.h"
+
+int crypto_aead_encrypt(uint8_t *c, size_t *clen, const uint8_t *m, size_t mlen, const uint8_t *ad, size_t adlen, const uint8_t *npub, const uint8_t *k){
+    /* Call AEAD function */
+    subterranean_SAE_direct_encrypt(c, &c[mlen], k, CRYPTO_KEYBYTES, npub, CRYPTO_NPUBBYTES, CRYPTO_ABYTES, ad, adlen, m, mlen);
+    /* Compact output */
+    *clen = mlen+CRYPTO_ABYTES;
+    return 0;
+}
+
+int crypto_aead_decrypt(uint8_t *m, size_t *mlen, const uint8_t *c, size_t clen, const uint8_t *ad, size_t adlen, const uint8_t *npub, const uint8_t *k){
+    uint8_t t[CRYPTO_ABYTES];
+    int tags_match;
+    /* Call AEAD function */
+    tags_match = subterranean_SAE_direct_decrypt(m, t, k, CRYPTO_KEYBYTES, npub, CRYPTO_NPUBBYTES, &c[clen-CRYPTO_ABYTES], CRYPTO_ABYTES, ad, adlen, c, clen-CRYPTO_ABYTES);
+    /* Compact output */
+    *mlen = clen-CRYPTO_ABYTES;
+    return tags_match;
+}
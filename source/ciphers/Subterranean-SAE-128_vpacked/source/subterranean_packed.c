@@ -0,0 +1,365 @@
+/*
+  Subterranean with a bit-packed state, see subterranean_packed.h.
+
+  chi, iota and theta are computed on whole words, on copies of the state
+  rotated by 1, 2, 3 and 8 bits (modulo 257).
+
+  pi sets bit i to bit 12i mod 257: laying the state out in rows of 12
+  bits, column c (bits c, c+12, c+24, ...) becomes a run of consecutive
+  bits.  Each piece of a column within a 64-bit word is gathered with one
+  mask and one multiplication (the partial products of the stride-12 bits
+  never overlap, so there is no carry), then shifted into place.
+
+  duplex and extract touch the fixed positions of subterranean_io_bits_0/1
+  with one shift and mask per bit.  The unrolled expressions are generated
+  from subterranean_pi_permutation and subterranean_io_bits_0/1 of
+  subterranean_ref.c.
+
+  Modified in 2026 by FELICS-AE contributors: packed state, from
+  subterranean_ref.c.
+*/
+
+#include "subterranean_packed.h"
+
+/* bit from of x moved to bit to */
+#define BDN(x, from, to) \
+    ((from) >= (to) ? ((x) >> (((from) - (to)) & 63)) & ((uint64_t)1 << (to)) \
+                    : ((x) << (((to) - (from)) & 63)) & ((uint64_t)1 << (to)))
+
+/* where the padding bit of a duplex of j bits goes */
+static const uint16_t subterranean_io_bits_0[33] = {1, 176, 136, 35, 249, 134, 197, 234, 64, 213, 223, 184, 2, 95, 15, 70, 241, 11, 137, 211, 128, 169, 189, 111, 4, 190, 30, 140, 225, 22, 17, 165, 256};
+
+static uint32_t load_bytes(const uint8_t * p, size_t n){
+    uint32_t x = 0;
+    size_t i;
+    for(i = 0; i < n; i++){
+        x |= (uint32_t)p[i] << (8*i);
+    }
+    return x;
+}
+
+static void store_bytes(uint8_t * p, uint32_t x, size_t n){
+    size_t i;
+    for(i = 0; i < n; i++){
+        p[i] = (uint8_t)(x >> (8*i));
+    }
+}
+
+/* r <= s rotated by k bits (0 < k < 64): bit i of r is bit (i+k) mod 257 of s */
+static inline void rotate(uint64_t r[SUBTERRANEAN_WORDS], const uint64_t s[SUBTERRANEAN_WORDS], unsigned int k){
+    /* bits 256 to 319, wrapping around */
+    uint64_t top = (s[4] & 1) | (s[0] << 1);
+    unsigned int i;
+    for(i = 0; i < 3; i++){
+        r[i] = (s[i] >> k) | (s[i+1] << (64 - k));
+    }
+    r[3] = (s[3] >> k) | (top << (64 - k));
+    r[4] = (top >> k) & 1;
+}
+
+/**
+* Subterranean round function
+* The input state is updated with the new state.
+*/
+void subterranean_round(uint64_t state[SUBTERRANEAN_WORDS]){
+    uint64_t t[SUBTERRANEAN_WORDS], r1[SUBTERRANEAN_WORDS], r2[SUBTERRANEAN_WORDS];
+    unsigned int i;
+
+    /* Chi step */
+    rotate(r1, state, 1);
+    rotate(r2, state, 2);
+    for(i = 0; i < SUBTERRANEAN_WORDS; i++){
+        t[i] = state[i] ^ (~r1[i] & r2[i]);
+    }
+
+    /* Iota step */
+    t[0] ^= 1;
+
+    /* Theta step */
+    rotate(r1, t, 3);
+    rotate(r2, t, 8);
+    for(i = 0; i < SUBTERRANEAN_WORDS; i++){
+        t[i] ^= r1[i] ^ r2[i];
+    }
+
+    /* Pi step */
+    state[0] = ((t[0] & 0x1001001001001001ULL) * 0x0400801002004008ULL >> 58) |
+               ((t[1] & 0x0100100100100100ULL) * 0x0008010020040080ULL >> 59 << 6) |
+               ((t[2] & 0x0010010010010010ULL) * 0x0080100200400800ULL >> 59 << 11) |
+               ((t[3] & 0x1001001001001001ULL) * 0x0400801002004008ULL >> 58 << 16) |
+               ((t[0] & 0x4004004004004004ULL) * 0x0100200400801002ULL >> 58 << 43) |
+               ((t[1] & 0x0400400400400400ULL) * 0x0002004008010020ULL >> 59 << 49) |
+               ((t[2] & 0x0040040040040040ULL) * 0x0001002004008010ULL & 0x07c0000000000000ULL) |
+               ((t[3] & 0x0004004004004004ULL) * 0x0200400801002000ULL & 0xf800000000000000ULL) |
+               ((t[0] & 0x0080080080080080ULL) * 0x0010020040080100ULL >> 59 << 22) |
+               ((t[1] & 0x8008008008008008ULL) * 0x0080100200400801ULL >> 58 << 27) |
+               ((t[2] & 0x0800800800800800ULL) * 0x0001002004008010ULL >> 59 << 33) |
+               ((t[3] & 0x0080080080080080ULL) * 0x0010020040080100ULL >> 59 << 38);
+    state[1] = BDN(t[3], 62, 0) |
+               ((t[0] & 0x0010010010010010ULL) * 0x0080100200400800ULL >> 59 << 22) |
+               ((t[1] & 0x1001001001001001ULL) * 0x0400801002004008ULL >> 58 << 27) |
+               ((t[2] & 0x0100100100100100ULL) * 0x0008010020040080ULL >> 59 << 33) |
+               ((t[3] & 0x0010010010010010ULL) * 0x0080100200400800ULL >> 59 << 38) |
+               BDN(t[4], 0, 43) |
+               ((t[0] & 0x0200200200200200ULL) * 0x0004008010020040ULL >> 59 << 1) |
+               ((t[1] & 0x0020020020020020ULL) * 0x0040080100200400ULL >> 59 << 6) |
+               ((t[2] & 0x2002002002002002ULL) * 0x0200400801002004ULL >> 58 << 11) |
+               ((t[3] & 0x0200200200200200ULL) * 0x0004008010020040ULL >> 59 << 17) |
+               ((t[0] & 0x0800800800800800ULL) * 0x0001002004008010ULL >> 59 << 44) |
+               ((t[1] & 0x0080080080080080ULL) * 0x0010020040080100ULL >> 59 << 49) |
+               ((t[2] & 0x8008008008008008ULL) * 0x0080100200400801ULL >> 58 << 54) |
+               ((t[3] & 0x0000800800800800ULL) * 0x0002004008010000ULL & 0xf000000000000000ULL);
+    state[2] = ((t[0] & 0x2002002002002002ULL) * 0x0200400801002004ULL >> 58 << 22) |
+               ((t[1] & 0x0200200200200200ULL) * 0x0004008010020040ULL >> 59 << 28) |
+               ((t[2] & 0x0020020020020020ULL) * 0x0040080100200400ULL >> 59 << 33) |
+               ((t[3] & 0x2002002002002002ULL) * 0x0200400801002004ULL >> 58 << 38) |
+               ((t[0] & 0x0040040040040040ULL) * 0x0020040080100200ULL >> 59 << 1) |
+               ((t[1] & 0x4004004004004004ULL) * 0x0100200400801002ULL >> 58 << 6) |
+               ((t[2] & 0x0400400400400400ULL) * 0x0002004008010020ULL >> 59 << 12) |
+               ((t[3] & 0x0040040040040040ULL) * 0x0020040080100200ULL >> 59 << 17) |
+               ((t[0] & 0x0100100100100100ULL) * 0x0008010020040080ULL >> 59 << 44) |
+               ((t[1] & 0x0010010010010010ULL) * 0x0000200400801002ULL & 0x003e000000000000ULL) |
+               ((t[2] & 0x1001001001001001ULL) * 0x0400801002004008ULL >> 58 << 54) |
+               ((t[3] & 0x0000100100100100ULL) * 0x0010020040080000ULL & 0xf000000000000000ULL) |
+               BDN(t[3], 59, 0);
+    state[3] = ((t[0] & 0x8008008008008008ULL) * 0x0080100200400801ULL >> 58 << 1) |
+               ((t[1] & 0x0800800800800800ULL) * 0x0001002004008010ULL >> 59 << 7) |
+               ((t[2] & 0x0080080080080080ULL) * 0x0010020040080100ULL >> 59 << 12) |
+               ((t[3] & 0x8008008008008008ULL) * 0x0080100200400801ULL >> 58 << 17) |
+               ((t[0] & 0x0020020020020020ULL) * 0x0040080100200400ULL >> 59 << 44) |
+               ((t[1] & 0x2002002002002002ULL) * 0x0200400801002004ULL >> 58 << 49) |
+               ((t[2] & 0x0200200200200200ULL) * 0x0000400801002004ULL & 0x0f80000000000000ULL) |
+               ((t[3] & 0x0000020020020020ULL) * 0x0080100200400000ULL & 0xf000000000000000ULL) |
+               BDN(t[3], 56, 0) |
+               ((t[0] & 0x0400400400400400ULL) * 0x0002004008010020ULL >> 59 << 23) |
+               ((t[1] & 0x0040040040040040ULL) * 0x0020040080100200ULL >> 59 << 28) |
+               ((t[2] & 0x4004004004004004ULL) * 0x0100200400801002ULL >> 58 << 33) |
+               ((t[3] & 0x0400400400400400ULL) * 0x0002004008010020ULL >> 59 << 39);
+    state[4] = BDN(t[3], 53, 0);
+}
+
+/**
+* Fills Subterranean with 0's
+*/
+void subterranean_init(uint64_t state[SUBTERRANEAN_WORDS]){
+    unsigned int i;
+    for(i = 0; i < SUBTERRANEAN_WORDS; i++){
+        state[i] = 0;
+    }
+}
+
+/**
+* Perform a duplex with the size (at most 32) low bits of sigma
+*/
+void subterranean_duplex(uint64_t state[SUBTERRANEAN_WORDS], uint32_t sigma, unsigned int size){
+    uint64_t x = size < 32 ? sigma & ((1u << size) - 1) : sigma;
+    unsigned int pad = subterranean_io_bits_0[size];
+    /* s <= R(s) */
+    subterranean_round(state);
+    /* sbar <= sbar + sigma */
+    state[0] ^= BDN(x,  0,  1) | BDN(x,  3, 35) | BDN(x, 12,  2) |
+                BDN(x, 14, 15) | BDN(x, 17, 11) | BDN(x, 24,  4) |
+                BDN(x, 26, 30) | BDN(x, 29, 22) | BDN(x, 30, 17);
+    state[1] ^= BDN(x,  8,  0) | BDN(x, 13, 31) | BDN(x, 15,  6) |
+                BDN(x, 23, 47);
+    state[2] ^= BDN(x,  1, 48) | BDN(x,  2,  8) | BDN(x,  5,  6) |
+                BDN(x, 11, 56) | BDN(x, 18,  9) | BDN(x, 20,  0) |
+                BDN(x, 21, 41) | BDN(x, 22, 61) | BDN(x, 25, 62) |
+                BDN(x, 27, 12) | BDN(x, 31, 37);
+    state[3] ^= BDN(x,  4, 57) | BDN(x,  6,  5) | BDN(x,  7, 42) |
+                BDN(x,  9, 21) | BDN(x, 10, 31) | BDN(x, 16, 49) |
+                BDN(x, 19, 19) | BDN(x, 28, 33);
+    /* sbar <= sbar + (1||0*) */
+    state[pad >> 6] ^= (uint64_t)1 << (pad & 63);
+}
+
+/**
+* Perform an extract
+*/
+uint32_t subterranean_extract(const uint64_t state[SUBTERRANEAN_WORDS]){
+    return (uint32_t)(BDN(state[0],  1,  0) ^ BDN(state[4],  0,  0) ^
+                      BDN(state[2], 48,  1) ^ BDN(state[1], 17,  1) ^
+                      BDN(state[2],  8,  2) ^ BDN(state[1], 57,  2) ^
+                      BDN(state[0], 35,  3) ^ BDN(state[3], 30,  3) ^
+                      BDN(state[3], 57,  4) ^ BDN(state[0],  8,  4) ^
+                      BDN(state[2],  6,  5) ^ BDN(state[1], 59,  5) ^
+                      BDN(state[3],  5,  6) ^ BDN(state[0], 60,  6) ^
+                      BDN(state[3], 42,  7) ^ BDN(state[0], 23,  7) ^
+                      BDN(state[1],  0,  8) ^ BDN(state[3],  1,  8) ^
+                      BDN(state[3], 21,  9) ^ BDN(state[0], 44,  9) ^
+                      BDN(state[3], 31, 10) ^ BDN(state[0], 34, 10) ^
+                      BDN(state[2], 56, 11) ^ BDN(state[1],  9, 11) ^
+                      BDN(state[0],  2, 12) ^ BDN(state[3], 63, 12) ^
+                      BDN(state[1], 31, 13) ^ BDN(state[2], 34, 13) ^
+                      BDN(state[0], 15, 14) ^ BDN(state[3], 50, 14) ^
+                      BDN(state[1],  6, 15) ^ BDN(state[2], 59, 15) ^
+                      BDN(state[3], 49, 16) ^ BDN(state[0], 16, 16) ^
+                      BDN(state[0], 11, 17) ^ BDN(state[3], 54, 17) ^
+                      BDN(state[2],  9, 18) ^ BDN(state[1], 56, 18) ^
+                      BDN(state[3], 19, 19) ^ BDN(state[0], 46, 19) ^
+                      BDN(state[2],  0, 20) ^ BDN(state[2],  1, 20) ^
+                      BDN(state[2], 41, 21) ^ BDN(state[1], 24, 21) ^
+                      BDN(state[2], 61, 22) ^ BDN(state[1],  4, 22) ^
+                      BDN(state[1], 47, 23) ^ BDN(state[2], 18, 23) ^
+                      BDN(state[0],  4, 24) ^ BDN(state[3], 61, 24) ^
+                      BDN(state[2], 62, 25) ^ BDN(state[1],  3, 25) ^
+                      BDN(state[0], 30, 26) ^ BDN(state[3], 35, 26) ^
+                      BDN(state[2], 12, 27) ^ BDN(state[1], 53, 27) ^
+                      BDN(state[3], 33, 28) ^ BDN(state[0], 32, 28) ^
+                      BDN(state[0], 22, 29) ^ BDN(state[3], 43, 29) ^
+                      BDN(state[0], 17, 30) ^ BDN(state[3], 48, 30) ^
+                      BDN(state[2], 37, 31) ^ BDN(state[1], 28, 31));
+}
+
+/**
+* Perform a blank into the state
+*/
+void subterranean_blank(uint64_t state[SUBTERRANEAN_WORDS], unsigned int r_calls){
+    unsigned int i;
+    /* for r times do duplex() */
+    for(i = 0; i < r_calls; i++){
+        subterranean_duplex(state, 0, 0);
+    }
+}
+
+/**
+* Perform a squeeze
+*/
+void subterranean_squeeze(uint64_t state[SUBTERRANEAN_WORDS], uint8_t * value_out, size_t value_out_length){
+    size_t i;
+
+    /*
+     * while |Z| < l do
+     *     temp <= extract(s)
+     *     Z <= Z||temp
+     */
+    for(i = 0; value_out_length - i > 4; i += 4){
+        store_bytes(&value_out[i], subterranean_extract(state), 4);
+        subterranean_duplex(state, 0, 0);
+    }
+    store_bytes(&value_out[i], subterranean_extract(state), value_out_length - i);
+}
+
+/**
+* Perform a simple absorb keyed
+*
+*/
+void subterranean_absorb_keyed(uint64_t state[SUBTERRANEAN_WORDS], const uint8_t * value_in, size_t value_in_length){
+    size_t i;
+
+    /* Let x[n] be X split in 32-bit blocks, with last block strictly shorter */
+    for(i = 0; i + 4 <= value_in_length; i += 4){
+        subterranean_duplex(state, load_bytes(&value_in[i], 4), 32);
+    }
+    subterranean_duplex(state, load_bytes(&value_in[i], value_in_length - i), 8*(value_in_length - i));
+}
+
+/**
+* Perform a simple absorb encrypt
+*
+*/
+void subterranean_absorb_encrypt(uint64_t state[SUBTERRANEAN_WORDS], uint8_t * value_out, const uint8_t * value_in, size_t value_in_length){
+    size_t i;
+    uint32_t x;
+
+    /*
+    * for all blocks of x[n] do
+    *     temp <= x[i] + (extract(s) truncated to |x[i]|)
+    *     Y <= Y || temp
+    *     duplex(x[i])
+    */
+    for(i = 0; i + 4 <= value_in_length; i += 4){
+        x = load_bytes(&value_in[i], 4);
+        store_bytes(&value_out[i], x ^ subterranean_extract(state), 4);
+        subterranean_duplex(state, x, 32);
+    }
+    x = load_bytes(&value_in[i], value_in_length - i);
+    store_bytes(&value_out[i], x ^ subterranean_extract(state), value_in_length - i);
+    subterranean_duplex(state, x, 8*(value_in_length - i));
+}
+
+/**
+* Perform a simple absorb decrypt
+*
+*/
+void subterranean_absorb_decrypt(uint64_t state[SUBTERRANEAN_WORDS], uint8_t * value_out, const uint8_t * value_in, size_t value_in_length){
+    size_t i;
+    uint32_t x;
+
+    /*
+    * for all blocks of x[n] do
+    *     temp <= x[i] + (extract(s) truncated to |x[i]|)
+    *     Y <= Y || temp
+    *     duplex(temp)
+    */
+    for(i = 0; i + 4 <= value_in_length; i += 4){
+        x = load_bytes(&value_in[i], 4) ^ subterranean_extract(state);
+        store_bytes(&value_out[i], x, 4);
+        subterranean_duplex(state, x, 32);
+    }
+    x = load_bytes(&value_in[i], value_in_length - i) ^ subterranean_extract(state);
+    store_bytes(&value_out[i], x, value_in_length - i);
+    subterranean_duplex(state, x, 8*(value_in_length - i));
+}
+
+static void subterranean_SAE_start(uint64_t state[SUBTERRANEAN_WORDS], const uint8_t * k, size_t k_length, const uint8_t * n, size_t n_length, const uint8_t * a, size_t a_length){
+    /* S <= Subterranean() */
+    subterranean_init(state);
+    /* S.absorb(K) */
+    subterranean_absorb_keyed(state, k, k_length);
+    /* S.absorb(N) */
+    subterranean_absorb_keyed(state, n, n_length);
+    /* S.blank(8) */
+    subterranean_blank(state, 8);
+    /* S.absorb(A,MAC) */
+    subterranean_absorb_keyed(state, a, a_length);
+}
+
+/**
+* Apply the SAE encryption directly for one message, key and associated data
+*
+*/
+void subterranean_SAE_direct_encrypt(uint8_t * y, uint8_t * t, const uint8_t * k, size_t k_length, const uint8_t * n, size_t n_length, size_t t_length, const uint8_t * a, size_t a_length, const uint8_t * x, size_t x_length){
+    uint64_t state[SUBTERRANEAN_WORDS];
+
+    subterranean_SAE_start(state, k, k_length, n, n_length, a, a_length);
+    /* Y <= S.absorb(X,op) */
+    subterranean_absorb_encrypt(state, y, x, x_length);
+    /* S.blank(8) */
+    subterranean_blank(state, 8);
+    /* T <= S.squeeze(tau) */
+    subterranean_squeeze(state, t, t_length);
+}
+
+/**
+* Apply the SAE decryption directly for one message, key and associated data
+*
+*/
+int subterranean_SAE_direct_decrypt(uint8_t * y, uint8_t * t, const uint8_t * k, size_t k_length, const uint8_t * n, size_t n_length, const uint8_t * t_prime, size_t t_length, const uint8_t * a, size_t a_length, const uint8_t * x, size_t x_length){
+    uint64_t state[SUBTERRANEAN_WORDS];
+    size_t i;
+    uint8_t tag_different;
+
+    subterranean_SAE_start(state, k, k_length, n, n_length, a, a_length);
+    /* Y <= S.absorb(X,op) */
+    subterranean_absorb_decrypt(state, y, x, x_length);
+    /* S.blank(8) */
+    subterranean_blank(state, 8);
+    /* T <= S.squeeze(tau) */
+    subterranean_squeeze(state, t, t_length);
+    /* if op = decrypt AND (tag != new_tag) then (Y,T) = (*,*) */
+    tag_different = 0;
+    for(i = 0; i < t_length; i++){
+        tag_different |= t[i] ^ t_prime[i];
+    }
+    if(tag_different != 0){
+        for(i = 0; i < x_length; i++){
+            y[i] = 0;
+        }
+        for(i = 0; i < t_length; i++){
+            t[i] = 0;
+        }
+        return -1;
+    }
+    return 0;
+}
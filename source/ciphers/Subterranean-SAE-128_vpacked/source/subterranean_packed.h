@@ -0,0 +1,35 @@
+#ifndef _SUBTERRANEAN_PACKED_H_
+#define _SUBTERRANEAN_PACKED_H_
+
+/*
+  Subterranean with its 257-bit state packed into 64-bit words: bit i of
+  the reference state is bit i%64 of word i/64, the last word only holds
+  bit 256.  Duplex blocks are up to 32 bits, taken little-endian from the
+  bytes as in the reference's byte_array_to_bit_array(); lengths are in
+  bytes.
+
+  Modified in 2026 by FELICS-AE contributors: packed state, from
+  subterranean_ref.h.
+*/
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define SUBTERRANEAN_SIZE 257
+#define SUBTERRANEAN_WORDS 5
+
+void subterranean_round(uint64_t state[SUBTERRANEAN_WORDS]);
+
+void subterranean_init(uint64_t state[SUBTERRANEAN_WORDS]);
+void subterranean_absorb_keyed(uint64_t state[SUBTERRANEAN_WORDS], const uint8_t * value_in, size_t value_in_length);
+void subterranean_absorb_encrypt(uint64_t state[SUBTERRANEAN_WORDS], uint8_t * value_out, const uint8_t * value_in, size_t value_in_length);
+void subterranean_absorb_decrypt(uint64_t state[SUBTERRANEAN_WORDS], uint8_t * value_out, const uint8_t * value_in, size_t value_in_length);
+void subterranean_duplex(uint64_t state[SUBTERRANEAN_WORDS], uint32_t sigma, unsigned int size);
+uint32_t subterranean_extract(const uint64_t state[SUBTERRANEAN_WORDS]);
+void subterranean_blank(uint64_t state[SUBTERRANEAN_WORDS], unsigned int r_calls);
+void subterranean_squeeze(uint64_t state[SUBTERRANEAN_WORDS], uint8_t * value_out, size_t value_out_length);
+
+void subterranean_SAE_direct_encrypt(uint8_t * y, uint8_t * t, const uint8_t * k, size_t k_length, const uint8_t * n, size_t n_length, size_t t_length, const uint8_t * a, size_t a_length, const uint8_t * x, size_t x_length);
+int subterranean_SAE_direct_decrypt(uint8_t * y, uint8_t * t, const uint8_t * k, size_t k_length, const uint8_t * n, size_t n_length, const uint8_t * t_prime, size_t t_length, const uint8_t * a, size_t a_length, const uint8_t * x, size_t x_length);
+
+#endif
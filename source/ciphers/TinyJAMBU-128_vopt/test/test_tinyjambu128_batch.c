@@ -0,0 +1,159 @@
+/*
+  Checks every lane of the batch TinyJAMBU-128 of tinyjambu128_batch.c
+  against crypto_aead_encrypt and crypto_aead_decrypt: equal lengths in
+  all lanes, then different lengths of associated data and message in
+  each lane, with distinct keys, nonces and contents per lane, and a
+  forged tag in one lane at a time.
+*/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "api.h"
+#include "crypto_aead.h"
+#include "tinyjambu128_batch.h"
+
+
+#define LANES       8
+#define MAX_LEN     41
+#define ROUNDS      2000
+
+
+static uint32_t seed = 1;
+
+static uint32_t random_word(void)
+{
+    seed = seed * 1103515245 + 12345;
+    return seed >> 16;
+}
+
+static void random_bytes(uint8_t *p, size_t len)
+{
+    size_t i;
+
+    for (i = 0; i < len; i++)
+    {
+        p[i] = (uint8_t)random_word();
+    }
+}
+
+
+// run one batch with the lengths adlen[i] and mlen[i] in lane i and compare
+// each lane with the one-message API; return the number of mismatches
+static int test_batch(const size_t adlen[LANES], const size_t mlen[LANES])
+{
+    uint8_t k[LANES][CRYPTO_KEYBYTES], n[LANES][CRYPTO_NPUBBYTES];
+    uint8_t ad[LANES][MAX_LEN + 1], m[LANES][MAX_LEN + 1];
+    uint8_t c[LANES][MAX_LEN + CRYPTO_ABYTES], d[LANES][MAX_LEN + 1];
+    uint8_t expected[MAX_LEN + CRYPTO_ABYTES];
+    const uint8_t *kp[LANES], *np[LANES], *adp[LANES], *mp[LANES], *cp[LANES];
+    uint8_t *co[LANES], *dout[LANES];
+    size_t clen[LANES];
+    size_t explen;
+    int i, wrong, errors = 0;
+
+    for (i = 0; i < LANES; i++)
+    {
+        random_bytes(k[i], CRYPTO_KEYBYTES);
+        random_bytes(n[i], CRYPTO_NPUBBYTES);
+        random_bytes(ad[i], adlen[i]);
+        random_bytes(m[i], mlen[i]);
+        kp[i] = k[i]; np[i] = n[i]; adp[i] = ad[i]; mp[i] = m[i];
+        co[i] = c[i]; cp[i] = c[i]; dout[i] = d[i];
+        clen[i] = mlen[i] + CRYPTO_ABYTES;
+    }
+
+    tinyjambu128_x8_encrypt(co, mp, mlen, adp, adlen, np, kp);
+
+    for (i = 0; i < LANES; i++)
+    {
+        crypto_aead_encrypt(expected, &explen, m[i], mlen[i], ad[i], adlen[i], n[i], k[i]);
+        if (explen != clen[i] || memcmp(c[i], expected, clen[i]) != 0)
+        {
+            printf("lane %d encrypts wrongly (adlen %zu, mlen %zu)\n", i, adlen[i], mlen[i]);
+            errors++;
+        }
+        else if (crypto_aead_decrypt(d[i], &explen, c[i], clen[i], ad[i], adlen[i], n[i], k[i]) != 0)
+        {
+            printf("lane %d is rejected by crypto_aead_decrypt (adlen %zu, mlen %zu)\n", i, adlen[i], mlen[i]);
+            errors++;
+        }
+    }
+
+    memset(d, 0, sizeof(d));
+    wrong = tinyjambu128_x8_decrypt(dout, cp, clen, adp, adlen, np, kp);
+    for (i = 0; i < LANES; i++)
+    {
+        if ((wrong >> i) & 1 || memcmp(d[i], m[i], mlen[i]) != 0)
+        {
+            printf("lane %d decrypts wrongly (adlen %zu, mlen %zu)\n", i, adlen[i], mlen[i]);
+            errors++;
+        }
+    }
+
+    // a forged tag in one lane must be reported for that lane only
+    i = (int)(random_word() % LANES);
+    c[i][mlen[i] + random_word() % CRYPTO_ABYTES] ^= 0x01;
+    wrong = tinyjambu128_x8_decrypt(dout, cp, clen, adp, adlen, np, kp);
+    if (wrong != 1 << i)
+    {
+        printf("forgery in lane %d reported as 0x%x (adlen %zu, mlen %zu)\n", i, wrong, adlen[i], mlen[i]);
+        errors++;
+    }
+
+    return errors;
+}
+
+
+int main(void)
+{
+    size_t adlen[LANES], mlen[LANES];
+    int i, l, r, errors = 0;
+
+    if (!__builtin_cpu_supports("avx2"))
+    {
+        printf("skipped, AVX2 is not supported\n");
+        return 0;
+    }
+
+    // the same lengths in every lane
+    for (l = 0; l <= MAX_LEN; l++)
+    {
+        for (r = 0; r <= MAX_LEN; r++)
+        {
+            for (i = 0; i < LANES; i++)
+            {
+                adlen[i] = l;
+                mlen[i] = r;
+            }
+            errors += test_batch(adlen, mlen);
+        }
+    }
+
+    // lengths spread over the lanes, so that lanes run out of blocks at
+    // different offsets
+    for (l = 0; l <= MAX_LEN; l++)
+    {
+        for (i = 0; i < LANES; i++)
+        {
+            adlen[i] = (l + 5 * i) % (MAX_LEN + 1);
+            mlen[i] = (l * 3 + 7 * i) % (MAX_LEN + 1);
+        }
+        errors += test_batch(adlen, mlen);
+    }
+
+    // pseudo-random lengths, empty ones included
+    for (r = 0; r < ROUNDS; r++)
+    {
+        for (i = 0; i < LANES; i++)
+        {
+            adlen[i] = random_word() % (MAX_LEN + 1);
+            mlen[i] = random_word() % (MAX_LEN + 1);
+        }
+        errors += test_batch(adlen, mlen);
+    }
+
+    printf("%s\n", errors ? "WRONG!" : "CORRECT!");
+    return errors != 0;
+}
@@ -0,0 +1,285 @@
+/*
+  Batch TinyJAMBU-128 with AVX2, see tinyjambu128_batch.h.
+
+  Word j of the state of every message (see state_update() in the
+  encrypt.c of TinyJAMBU-128_vopt) is held in register s[j], one message
+  per 32-bit lane, and advanced 128 steps at a time as in encrypt.c.  For
+  the associated data and the message, the lanes that have a block at the
+  current offset are the active ones: they get the frame bits, and only
+  their new state is kept after the update; the others absorb a zero
+  word.
+*/
+
+#pragma GCC target("avx2")
+
+#include <stdint.h>
+#include <immintrin.h>
+
+#include "tinyjambu128_batch.h"
+
+
+#define FrameBitsIV  0x10
+#define FrameBitsAD  0x30
+#define FrameBitsPC  0x50
+#define FrameBitsFinalization 0x70
+
+#define NROUND1 128*5
+#define NROUND2 128*8
+
+#define LANES 8
+
+#define VXOR(a, b)          _mm256_xor_si256((a), (b))
+#define VAND(a, b)          _mm256_and_si256((a), (b))
+#define VOR(a, b)           _mm256_or_si256((a), (b))
+#define VNAND(a, b)         _mm256_xor_si256(_mm256_and_si256((a), (b)), _mm256_set1_epi32(-1))
+// bits n to n+31 of the 64-bit word hi || lo
+#define VFUNNEL(hi, lo, n)  VOR(_mm256_srli_epi32((lo), (n)), _mm256_slli_epi32((hi), 32-(n)))
+
+
+// a block of every lane at some offset of their inputs
+typedef struct
+{
+    __m256i word;       // little-endian, zero-padded
+    __m256i bytes;      // mask of the bytes of the block
+    __m256i active;     // all ones if the lane has a block there
+    __m256i partial;    // number of bytes of a partial block, or 0
+} lane_block;
+
+
+static inline uint32_t load32(const uint8_t *p)
+{
+    return (uint32_t)p[0] | (uint32_t)p[1] << 8 | (uint32_t)p[2] << 16 | (uint32_t)p[3] << 24;
+}
+
+
+// gather 4-byte word i of every p[l]
+static inline __m256i load_words(const uint8_t *const p[LANES], size_t i)
+{
+    return _mm256_setr_epi32(
+        load32(p[0]+4*i), load32(p[1]+4*i), load32(p[2]+4*i), load32(p[3]+4*i),
+        load32(p[4]+4*i), load32(p[5]+4*i), load32(p[6]+4*i), load32(p[7]+4*i));
+}
+
+
+// gather the block at offset off of every p[l], of len[l] bytes
+static void load_block(lane_block *b, const uint8_t *const p[LANES], const size_t len[LANES], size_t off)
+{
+    uint32_t word[LANES], bytes[LANES], partial[LANES];
+    size_t n, j;
+    int l;
+
+    for (l = 0; l < LANES; l++)
+    {
+        n = len[l] > off ? len[l] - off : 0;
+        if (n >= 4)
+        {
+            word[l] = load32(p[l] + off);
+            bytes[l] = 0xffffffff;
+            partial[l] = 0;
+        }
+        else
+        {
+            word[l] = 0;
+            for (j = 0; j < n; j++) word[l] |= (uint32_t)p[l][off + j] << (8*j);
+            bytes[l] = (1u << (8*n)) - 1;
+            partial[l] = n;
+        }
+    }
+    b->word = _mm256_loadu_si256((const __m256i *)word);
+    b->bytes = _mm256_loadu_si256((const __m256i *)bytes);
+    b->active = VXOR(_mm256_cmpeq_epi32(b->bytes, _mm256_setzero_si256()), _mm256_set1_epi32(-1));
+    b->partial = _mm256_loadu_si256((const __m256i *)partial);
+}
+
+
+// scatter the words of w to the blocks at offset off of every p[l], of len[l] bytes
+static void store_block(uint8_t *const p[LANES], const size_t len[LANES], size_t off, __m256i w)
+{
+    uint32_t word[LANES];
+    size_t n, j;
+    int l;
+
+    _mm256_storeu_si256((__m256i *)word, w);
+    for (l = 0; l < LANES; l++)
+    {
+        n = len[l] > off ? len[l] - off : 0;
+        for (j = 0; j < n && j < 4; j++) p[l][off + j] = (uint8_t)(word[l] >> (8*j));
+    }
+}
+
+
+// as state_update(), keeping the old state of the lanes that are not active
+static void state_update(__m256i s[4], const __m256i k[4], unsigned int number_of_steps, __m256i active)
+{
+    __m256i s0 = s[0], s1 = s[1], s2 = s[2], s3 = s[3];
+    __m256i t1, t2, t3, t4;
+    unsigned int i;
+
+    for (i = 0; i < number_of_steps; i = i + 128)
+    {
+        t1 = VFUNNEL(s2, s1, 15);
+        t2 = VFUNNEL(s3, s2, 6);
+        t3 = VFUNNEL(s3, s2, 21);
+        t4 = VFUNNEL(s3, s2, 27);
+        s0 = VXOR(s0, VXOR(VXOR(t1, VNAND(t2, t3)), VXOR(t4, k[0])));
+
+        t1 = VFUNNEL(s3, s2, 15);
+        t2 = VFUNNEL(s0, s3, 6);
+        t3 = VFUNNEL(s0, s3, 21);
+        t4 = VFUNNEL(s0, s3, 27);
+        s1 = VXOR(s1, VXOR(VXOR(t1, VNAND(t2, t3)), VXOR(t4, k[1])));
+
+        t1 = VFUNNEL(s0, s3, 15);
+        t2 = VFUNNEL(s1, s0, 6);
+        t3 = VFUNNEL(s1, s0, 21);
+        t4 = VFUNNEL(s1, s0, 27);
+        s2 = VXOR(s2, VXOR(VXOR(t1, VNAND(t2, t3)), VXOR(t4, k[2])));
+
+        t1 = VFUNNEL(s1, s0, 15);
+        t2 = VFUNNEL(s2, s1, 6);
+        t3 = VFUNNEL(s2, s1, 21);
+        t4 = VFUNNEL(s2, s1, 27);
+        s3 = VXOR(s3, VXOR(VXOR(t1, VNAND(t2, t3)), VXOR(t4, k[3])));
+    }
+
+    s[0] = _mm256_blendv_epi8(s[0], s0, active);
+    s[1] = _mm256_blendv_epi8(s[1], s1, active);
+    s[2] = _mm256_blendv_epi8(s[2], s2, active);
+    s[3] = _mm256_blendv_epi8(s[3], s3, active);
+}
+
+
+// as initialization() and process_ad()
+static void initialization(__m256i s[4], __m256i k[4], const uint8_t *const key[LANES], const uint8_t *const iv[LANES], const uint8_t *const ad[LANES], const size_t adlen[LANES])
+{
+    const __m256i all = _mm256_set1_epi32(-1);
+    lane_block b;
+    size_t off, maxlen = 0;
+    int i;
+
+    for (i = 0; i < 4; i++)
+    {
+        k[i] = load_words(key, i);
+        s[i] = _mm256_setzero_si256();
+    }
+
+    //update the state with the key
+    state_update(s, k, NROUND2, all);
+
+    //introduce IV into the state
+    for (i = 0; i < 3; i++)
+    {
+        s[1] = VXOR(s[1], _mm256_set1_epi32(FrameBitsIV));
+        state_update(s, k, NROUND1, all);
+        s[3] = VXOR(s[3], load_words(iv, i));
+    }
+
+    //process the associated data, up to the longest one
+    for (i = 0; i < LANES; i++) if (adlen[i] > maxlen) maxlen = adlen[i];
+    for (off = 0; off < maxlen; off += 4)
+    {
+        load_block(&b, ad, adlen, off);
+        s[1] = VXOR(s[1], VAND(_mm256_set1_epi32(FrameBitsAD), b.active));
+        state_update(s, k, NROUND1, b.active);
+        s[3] = VXOR(s[3], b.word);
+        s[1] = VXOR(s[1], b.partial);
+    }
+}
+
+
+// process the plaintext (decrypt = 0) or ciphertext of every lane
+static void process(__m256i s[4], const __m256i k[4], uint8_t *const out[LANES], const uint8_t *const in[LANES], const size_t len[LANES], int decrypt)
+{
+    lane_block b;
+    __m256i o;
+    size_t off, maxlen = 0;
+    int i;
+
+    for (i = 0; i < LANES; i++) if (len[i] > maxlen) maxlen = len[i];
+    for (off = 0; off < maxlen; off += 4)
+    {
+        load_block(&b, in, len, off);
+        s[1] = VXOR(s[1], VAND(_mm256_set1_epi32(FrameBitsPC), b.active));
+        state_update(s, k, NROUND2, b.active);
+        o = VAND(VXOR(s[2], b.word), b.bytes);
+        s[3] = VXOR(s[3], decrypt ? o : b.word);
+        s[1] = VXOR(s[1], b.partial);
+        store_block(out, len, off, o);
+    }
+}
+
+
+// finalization stage, tag word 0 to tag[0] and word 1 to tag[1]
+static void finalization(__m256i s[4], const __m256i k[4], __m256i tag[2])
+{
+    const __m256i all = _mm256_set1_epi32(-1);
+
+    s[1] = VXOR(s[1], _mm256_set1_epi32(FrameBitsFinalization));
+    state_update(s, k, NROUND2, all);
+    tag[0] = s[2];
+
+    s[1] = VXOR(s[1], _mm256_set1_epi32(FrameBitsFinalization));
+    state_update(s, k, NROUND1, all);
+    tag[1] = s[2];
+}
+
+
+void tinyjambu128_x8_encrypt(
+    uint8_t *const c[LANES],
+    const uint8_t *const m[LANES], const size_t mlen[LANES],
+    const uint8_t *const ad[LANES], const size_t adlen[LANES],
+    const uint8_t *const npub[LANES],
+    const uint8_t *const k[LANES]
+    )
+{
+    __m256i s[4], key[4], tag[2];
+    uint32_t t[2][LANES];
+    int i, j;
+
+    initialization(s, key, k, npub, ad, adlen);
+    process(s, key, c, m, mlen, 0);
+    finalization(s, key, tag);
+
+    _mm256_storeu_si256((__m256i *)t[0], tag[0]);
+    _mm256_storeu_si256((__m256i *)t[1], tag[1]);
+    for (i = 0; i < LANES; i++)
+        for (j = 0; j < 8; j++)
+            c[i][mlen[i] + j] = (uint8_t)(t[j >> 2][i] >> (8*(j & 3)));
+}
+
+
+int tinyjambu128_x8_decrypt(
+    uint8_t *const m[LANES],
+    const uint8_t *const c[LANES], const size_t clen[LANES],
+    const uint8_t *const ad[LANES], const size_t adlen[LANES],
+    const uint8_t *const npub[LANES],
+    const uint8_t *const k[LANES]
+    )
+{
+    __m256i s[4], key[4], tag[2];
+    uint32_t t[2][LANES];
+    size_t mlen[LANES];
+    int i, j, wrong = 0;
+
+    // a lane too short to hold a tag is wrong, and decrypts nothing
+    for (i = 0; i < LANES; i++)
+    {
+        mlen[i] = clen[i] >= 8 ? clen[i] - 8 : 0;
+        if (clen[i] < 8) wrong |= 1 << i;
+    }
+
+    initialization(s, key, k, npub, ad, adlen);
+    process(s, key, m, c, mlen, 1);
+    finalization(s, key, tag);
+
+    _mm256_storeu_si256((__m256i *)t[0], tag[0]);
+    _mm256_storeu_si256((__m256i *)t[1], tag[1]);
+    for (i = 0; i < LANES; i++)
+    {
+        uint8_t check = 0;
+        if (wrong & (1 << i)) continue;
+        for (j = 0; j < 8; j++) check |= (uint8_t)(t[j >> 2][i] >> (8*(j & 3))) ^ c[i][mlen[i] + j];
+        if (check) wrong |= 1 << i;
+    }
+    return wrong;
+}
@@ -0,0 +1,42 @@
+#ifndef TINYJAMBU128_BATCH_H
+#define TINYJAMBU128_BATCH_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+
+/*
+  Eight independent TinyJAMBU-128 messages processed together, one state
+  per 32-bit lane of AVX2 registers.  Keys, nonces and the lengths of the
+  messages and associated data are per lane: a lane without a block at
+  the current offset keeps its state while the others go on.
+
+  This is a library rather than a FELICS implementation, since
+  crypto_aead_encrypt/crypto_aead_decrypt only ever have one message; it
+  is meant for processing short frames in batches, since the
+  1024+3*640-step initialization dominates for them.  Callers must check
+  that the processor supports AVX2.  TinyJAMBU-128_vopt/test checks every
+  lane against that implementation.
+*/
+
+
+// encrypt mlen[i] bytes of each m[i] into c[i], followed by its 8-byte tag
+void tinyjambu128_x8_encrypt(
+    uint8_t *const c[8],
+    const uint8_t *const m[8], const size_t mlen[8],
+    const uint8_t *const ad[8], const size_t adlen[8],
+    const uint8_t *const npub[8],
+    const uint8_t *const k[8]
+    );
+
+// decrypt clen[i] bytes of each c[i] (tag included) into m[i];
+// return the mask of the lanes whose tag is wrong (0 if all are right)
+int tinyjambu128_x8_decrypt(
+    uint8_t *const m[8],
+    const uint8_t *const c[8], const size_t clen[8],
+    const uint8_t *const ad[8], const size_t adlen[8],
+    const uint8_t *const npub[8],
+    const uint8_t *const k[8]
+    );
+
+#endif /* TINYJAMBU128_BATCH_H */
@@ -0,0 +1 @@
+../../Xoodyak-128_vref/source/Cyclist.h
\ No newline at end of file
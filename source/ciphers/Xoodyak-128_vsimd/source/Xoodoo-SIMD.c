@@ -0,0 +1,174 @@
+/*
+Implementation by Ronny Van Keer, hereby denoted as "the implementer".
+
+For more information, feedback or questions, please refer to our website:
+https://keccak.team/
+
+To the extent possible under law, the implementer has waived all copyright
+and related or neighboring rights to the source code in this file.
+http://creativecommons.org/publicdomain/zero/1.0/
+
+Modified in 2026 by FELICS-AE contributors: each of the three planes of
+the state is an SSE2 register during the permutation.  On little-endian
+targets, the byte layout of the state is the one of the planes, so that
+the state is loaded and stored as is, without any conversion.
+*/
+
+#include <string.h>
+#include <assert.h>
+#include <emmintrin.h>
+#include "Xoodoo.h"
+#include "Xoodoo-SnP.h"
+
+typedef __m128i V128;
+
+#define XOR(a, b)       _mm_xor_si128((a), (b))
+#define ANDNOT(a, b)    _mm_andnot_si128((a), (b))
+#define ROL(a, o)       _mm_or_si128(_mm_slli_epi32((a), (o)), _mm_srli_epi32((a), 32-(o)))
+
+/* Lane x of the result is lane x-1 (resp. x+2) of the plane */
+#define SHIFT_WEST(a)   _mm_shuffle_epi32((a), _MM_SHUFFLE(2, 1, 0, 3))
+#define SHIFT_EAST2(a)  _mm_shuffle_epi32((a), _MM_SHUFFLE(1, 0, 3, 2))
+
+/* ---------------------------------------------------------------- */
+
+void Xoodoo_StaticInitialize( void )
+{
+}
+
+/* ---------------------------------------------------------------- */
+
+void Xoodoo_Initialize(void *state)
+{
+    memset(state, 0, NLANES*sizeof(tXoodooLane));
+}
+
+/* ---------------------------------------------------------------- */
+
+void Xoodoo_AddByte(void *state, unsigned char byte, unsigned int offset)
+{
+    assert(offset < NLANES*sizeof(tXoodooLane));
+    ((unsigned char *)state)[offset] ^= byte;
+}
+
+/* ---------------------------------------------------------------- */
+
+void Xoodoo_AddBytes(void *state, const unsigned char *data, unsigned int offset, unsigned int length)
+{
+    unsigned char *s = (unsigned char *)state + offset;
+
+    assert(offset < NLANES*sizeof(tXoodooLane));
+    assert(offset+length <= NLANES*sizeof(tXoodooLane));
+    for( ; length >= 16; length -= 16, s += 16, data += 16)
+        _mm_storeu_si128((V128 *)s, XOR(_mm_loadu_si128((const V128 *)s), _mm_loadu_si128((const V128 *)data)));
+    while (length-- != 0)
+        *s++ ^= *data++;
+}
+
+/* ---------------------------------------------------------------- */
+
+void Xoodoo_OverwriteBytes(void *state, const unsigned char *data, unsigned int offset, unsigned int length)
+{
+    assert(offset < NLANES*sizeof(tXoodooLane));
+    assert(offset+length <= NLANES*sizeof(tXoodooLane));
+    memcpy((unsigned char*)state+offset, data, length);
+}
+
+/* ---------------------------------------------------------------- */
+
+void Xoodoo_OverwriteWithZeroes(void *state, unsigned int byteCount)
+{
+    assert(byteCount <= NLANES*sizeof(tXoodooLane));
+    memset(state, 0, byteCount);
+}
+
+/* ---------------------------------------------------------------- */
+
+void Xoodoo_ExtractBytes(const void *state, unsigned char *data, unsigned int offset, unsigned int length)
+{
+    assert(offset < NLANES*sizeof(tXoodooLane));
+    assert(offset+length <= NLANES*sizeof(tXoodooLane));
+    memcpy(data, (unsigned char*)state+offset, length);
+}
+
+/* ---------------------------------------------------------------- */
+
+void Xoodoo_ExtractAndAddBytes(const void *state, const unsigned char *input, unsigned char *output, unsigned int offset, unsigned int length)
+{
+    const unsigned char *s = (const unsigned char *)state + offset;
+
+    assert(offset < NLANES*sizeof(tXoodooLane));
+    assert(offset+length <= NLANES*sizeof(tXoodooLane));
+    for( ; length >= 16; length -= 16, s += 16, input += 16, output += 16)
+        _mm_storeu_si128((V128 *)output, XOR(_mm_loadu_si128((const V128 *)s), _mm_loadu_si128((const V128 *)input)));
+    while (length-- != 0)
+        *output++ = *input++ ^ *s++;
+}
+
+/* ---------------------------------------------------------------- */
+
+static const uint32_t    RC[MAXROUNDS] = {
+    _rc12,
+    _rc11,
+    _rc10,
+    _rc9,
+    _rc8,
+    _rc7,
+    _rc6,
+    _rc5,
+    _rc4,
+    _rc3,
+    _rc2,
+    _rc1
+};
+
+void Xoodoo_Permute_Nrounds( void * state, unsigned int nr )
+{
+    V128            *planes = (V128 *)state;
+    V128            a0, a1, a2, p, e;
+    unsigned int    i;
+
+    a0 = _mm_load_si128(planes + 0);
+    a1 = _mm_load_si128(planes + 1);
+    a2 = _mm_load_si128(planes + 2);
+
+    for (i = MAXROUNDS - nr; i < MAXROUNDS; ++i ) {
+        /* Theta: Column Parity Mixer */
+        p = SHIFT_WEST(XOR(XOR(a0, a1), a2));
+        e = XOR(ROL(p, 5), ROL(p, 14));
+        a0 = XOR(a0, e);
+        a1 = XOR(a1, e);
+        a2 = XOR(a2, e);
+
+        /* Rho-west: plane shift */
+        a1 = SHIFT_WEST(a1);
+        a2 = ROL(a2, 11);
+
+        /* Iota: round constant */
+        a0 = XOR(a0, _mm_cvtsi32_si128((int)RC[i]));
+
+        /* Chi: non linear layer */
+        p  = XOR(a0, ANDNOT(a1, a2));
+        e  = XOR(a1, ANDNOT(a2, a0));
+        a2 = XOR(a2, ANDNOT(a0, a1));
+        a0 = p;
+
+        /* Rho-east: plane shift */
+        a1 = ROL(e, 1);
+        a2 = ROL(SHIFT_EAST2(a2), 8);
+    }
+
+    _mm_store_si128(planes + 0, a0);
+    _mm_store_si128(planes + 1, a1);
+    _mm_store_si128(planes + 2, a2);
+}
+
+void Xoodoo_Permute_6rounds( void * state)
+{
+    Xoodoo_Permute_Nrounds( state, 6 );
+}
+
+void Xoodoo_Permute_12rounds( void * state)
+{
+    Xoodoo_Permute_Nrounds( state, 12 );
+}
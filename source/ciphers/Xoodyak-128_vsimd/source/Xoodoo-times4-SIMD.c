@@ -0,0 +1,35 @@
+/*
+Implementation by Ronny Van Keer, hereby denoted as "the implementer".
+
+For more information, feedback or questions, please refer to our website:
+https://keccak.team/
+
+To the extent possible under law, the implementer has waived all copyright
+and related or neighboring rights to the source code in this file.
+http://creativecommons.org/publicdomain/zero/1.0/
+
+Modified in 2026 by FELICS-AE contributors: four Xoodoo states at once,
+one SSE2 register per lane.  Not used by Xoodyak itself, which only ever
+has one state; meant for processing independent messages in batches.
+*/
+
+#include <string.h>
+#include <assert.h>
+#include <emmintrin.h>
+#include "Xoodoo.h"
+#include "Xoodoo-times4-SnP.h"
+
+typedef __m128i V;
+
+#define LOAD(p)         _mm_load_si128(p)
+#define STORE(p, a)     _mm_store_si128((p), (a))
+#define XOR(a, b)       _mm_xor_si128((a), (b))
+#define ANDNOT(a, b)    _mm_andnot_si128((a), (b))
+#define ROL(a, o)       _mm_or_si128(_mm_slli_epi32((a), (o)), _mm_srli_epi32((a), 32-(o)))
+#define CONST(c)        _mm_set1_epi32((int)(c))
+
+#define PlSnP                           Xoodootimes4
+#define PlSnP_parallelism               4
+    #include "Xoodoo-timesN.inc"
+#undef  PlSnP
+#undef  PlSnP_parallelism
@@ -0,0 +1,35 @@
+/*
+Implementation by Ronny Van Keer, hereby denoted as "the implementer".
+
+For more information, feedback or questions, please refer to our website:
+https://keccak.team/
+
+To the extent possible under law, the implementer has waived all copyright
+and related or neighboring rights to the source code in this file.
+http://creativecommons.org/publicdomain/zero/1.0/
+*/
+
+#ifndef _Xoodoo_times4_SnP_h_
+#define _Xoodoo_times4_SnP_h_
+
+/** For the documentation, see PlSnP-documentation.h.
+ *
+ * 4 independent Xoodoo states, lane-interleaved: lane i of instance k is
+ * the 32-bit word 4*i+k of the states.
+ */
+
+#define Xoodootimes4_implementation      "128-bit SSE2 implementation"
+#define Xoodootimes4_statesSizeInBytes   (4*3*4*4)
+#define Xoodootimes4_statesAlignment     16
+
+void Xoodootimes4_StaticInitialize( void );
+void Xoodootimes4_InitializeAll(void *states);
+void Xoodootimes4_AddByte(void *states, unsigned int instanceIndex, unsigned char data, unsigned int offset);
+void Xoodootimes4_AddBytes(void *states, unsigned int instanceIndex, const unsigned char *data, unsigned int offset, unsigned int length);
+void Xoodootimes4_OverwriteBytes(void *states, unsigned int instanceIndex, const unsigned char *data, unsigned int offset, unsigned int length);
+void Xoodootimes4_PermuteAll_6rounds(void *states);
+void Xoodootimes4_PermuteAll_12rounds(void *states);
+void Xoodootimes4_ExtractBytes(const void *states, unsigned int instanceIndex, unsigned char *data, unsigned int offset, unsigned int length);
+void Xoodootimes4_ExtractAndAddBytes(const void *states, unsigned int instanceIndex, const unsigned char *input, unsigned char *output, unsigned int offset, unsigned int length);
+
+#endif
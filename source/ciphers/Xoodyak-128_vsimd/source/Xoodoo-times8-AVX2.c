@@ -0,0 +1,46 @@
+/*
+Implementation by Ronny Van Keer, hereby denoted as "the implementer".
+
+For more information, feedback or questions, please refer to our website:
+https://keccak.team/
+
+To the extent possible under law, the implementer has waived all copyright
+and related or neighboring rights to the source code in this file.
+http://creativecommons.org/publicdomain/zero/1.0/
+
+Modified in 2026 by FELICS-AE contributors: eight Xoodoo states at once,
+one AVX2 register per lane.  Not used by Xoodyak itself, which only ever
+has one state; meant for processing independent messages in batches.
+Callers must check that the processor supports AVX2.
+
+When compiled for AVX-512VL (e.g. with -mavx512vl), rotations use VPROLD.
+*/
+
+#if !defined(__AVX512VL__)
+#pragma GCC target("avx2")
+#endif
+
+#include <string.h>
+#include <assert.h>
+#include <immintrin.h>
+#include "Xoodoo.h"
+#include "Xoodoo-times8-SnP.h"
+
+typedef __m256i V;
+
+#define LOAD(p)         _mm256_load_si256(p)
+#define STORE(p, a)     _mm256_store_si256((p), (a))
+#define XOR(a, b)       _mm256_xor_si256((a), (b))
+#define ANDNOT(a, b)    _mm256_andnot_si256((a), (b))
+#if defined(__AVX512VL__)
+#define ROL(a, o)       _mm256_rol_epi32((a), (o))
+#else
+#define ROL(a, o)       _mm256_or_si256(_mm256_slli_epi32((a), (o)), _mm256_srli_epi32((a), 32-(o)))
+#endif
+#define CONST(c)        _mm256_set1_epi32((int)(c))
+
+#define PlSnP                           Xoodootimes8
+#define PlSnP_parallelism               8
+    #include "Xoodoo-timesN.inc"
+#undef  PlSnP
+#undef  PlSnP_parallelism
@@ -0,0 +1,35 @@
+/*
+Implementation by Ronny Van Keer, hereby denoted as "the implementer".
+
+For more information, feedback or questions, please refer to our website:
+https://keccak.team/
+
+To the extent possible under law, the implementer has waived all copyright
+and related or neighboring rights to the source code in this file.
+http://creativecommons.org/publicdomain/zero/1.0/
+*/
+
+#ifndef _Xoodoo_times8_SnP_h_
+#define _Xoodoo_times8_SnP_h_
+
+/** For the documentation, see PlSnP-documentation.h.
+ *
+ * 8 independent Xoodoo states, lane-interleaved: lane i of instance k is
+ * the 32-bit word 8*i+k of the states.
+ */
+
+#define Xoodootimes8_implementation      "256-bit AVX2 implementation"
+#define Xoodootimes8_statesSizeInBytes   (8*3*4*4)
+#define Xoodootimes8_statesAlignment     32
+
+void Xoodootimes8_StaticInitialize( void );
+void Xoodootimes8_InitializeAll(void *states);
+void Xoodootimes8_AddByte(void *states, unsigned int instanceIndex, unsigned char data, unsigned int offset);
+void Xoodootimes8_AddBytes(void *states, unsigned int instanceIndex, const unsigned char *data, unsigned int offset, unsigned int length);
+void Xoodootimes8_OverwriteBytes(void *states, unsigned int instanceIndex, const unsigned char *data, unsigned int offset, unsigned int length);
+void Xoodootimes8_PermuteAll_6rounds(void *states);
+void Xoodootimes8_PermuteAll_12rounds(void *states);
+void Xoodootimes8_ExtractBytes(const void *states, unsigned int instanceIndex, unsigned char *data, unsigned int offset, unsigned int length);
+void Xoodootimes8_ExtractAndAddBytes(const void *states, unsigned int instanceIndex, const unsigned char *input, unsigned char *output, unsigned int offset, unsigned int length);
+
+#endif
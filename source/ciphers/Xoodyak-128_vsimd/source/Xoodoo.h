@@ -0,0 +1 @@
+../../Xoodyak-128_vref/source/Xoodoo.h
\ No newline at end of file
@@ -0,0 +1 @@
+../../Xoodyak-128_vref/source/Xoodyak.c
\ No newline at end of file
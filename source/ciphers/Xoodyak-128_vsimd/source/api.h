@@ -0,0 +1 @@
+../../Xoodyak-128_vref/source/api.h
\ No newline at end of file
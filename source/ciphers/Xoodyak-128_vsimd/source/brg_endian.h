@@ -0,0 +1 @@
+../../Xoodyak-128_vref/source/brg_endian.h
\ No newline at end of file
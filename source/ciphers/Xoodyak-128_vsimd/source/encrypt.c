@@ -0,0 +1 @@
+../../Xoodyak-128_vref/source/encrypt.c
\ No newline at end of file
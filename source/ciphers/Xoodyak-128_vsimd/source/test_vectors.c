@@ -0,0 +1 @@
+../../Xoodyak-128_vref/source/test_vectors.c
\ No newline at end of file
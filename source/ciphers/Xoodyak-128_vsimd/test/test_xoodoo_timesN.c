@@ -0,0 +1,160 @@
+/*
+Written in 2026 by FELICS-AE contributors.
+
+Checks every instance of the parallel Xoodoo permutations against the
+single-state permutation, along with the byte-level accessors of the
+lane-interleaved states.
+*/
+
+#include <stdio.h>
+#include <string.h>
+#include "align.h"
+#include "Xoodoo.h"
+#include "Xoodoo-SnP.h"
+#include "Xoodoo-times4-SnP.h"
+#include "Xoodoo-times8-SnP.h"
+
+#define STATE_BYTES (NLANES*sizeof(tXoodooLane))
+#define MAX_PARALLELISM 8
+
+typedef void (*tInitializeAll)(void *states);
+typedef void (*tAddByte)(void *states, unsigned int instanceIndex, unsigned char data, unsigned int offset);
+typedef void (*tAddBytes)(void *states, unsigned int instanceIndex, const unsigned char *data, unsigned int offset, unsigned int length);
+typedef void (*tPermuteAll)(void *states);
+typedef void (*tExtractBytes)(const void *states, unsigned int instanceIndex, unsigned char *data, unsigned int offset, unsigned int length);
+typedef void (*tExtractAndAddBytes)(const void *states, unsigned int instanceIndex, const unsigned char *input, unsigned char *output, unsigned int offset, unsigned int length);
+
+typedef struct {
+    const char *name;
+    unsigned int parallelism;
+    tInitializeAll InitializeAll;
+    tAddByte AddByte;
+    tAddBytes AddBytes;
+    tAddBytes OverwriteBytes;
+    tPermuteAll PermuteAll_6rounds;
+    tPermuteAll PermuteAll_12rounds;
+    tExtractBytes ExtractBytes;
+    tExtractAndAddBytes ExtractAndAddBytes;
+} tPlSnP;
+
+static const tPlSnP times4 = {
+    "Xoodootimes4", 4,
+    Xoodootimes4_InitializeAll, Xoodootimes4_AddByte, Xoodootimes4_AddBytes,
+    Xoodootimes4_OverwriteBytes, Xoodootimes4_PermuteAll_6rounds,
+    Xoodootimes4_PermuteAll_12rounds, Xoodootimes4_ExtractBytes,
+    Xoodootimes4_ExtractAndAddBytes
+};
+
+static const tPlSnP times8 = {
+    "Xoodootimes8", 8,
+    Xoodootimes8_InitializeAll, Xoodootimes8_AddByte, Xoodootimes8_AddBytes,
+    Xoodootimes8_OverwriteBytes, Xoodootimes8_PermuteAll_6rounds,
+    Xoodootimes8_PermuteAll_12rounds, Xoodootimes8_ExtractBytes,
+    Xoodootimes8_ExtractAndAddBytes
+};
+
+static unsigned long seed = 1;
+
+static unsigned char randomByte(void)
+{
+    seed = seed*6364136223846793005UL + 1442695040888963407UL;
+    return (unsigned char)(seed >> 56);
+}
+
+static void randomBytes(unsigned char *data, unsigned int length)
+{
+    unsigned int i;
+
+    for (i = 0; i < length; i++)
+        data[i] = randomByte();
+}
+
+/* Runs the same operations on every instance of the parallel states and on
+ * as many single states, and compares the results; returns the number of
+ * mismatching instances. */
+static int testPlSnP(const tPlSnP *p)
+{
+    ALIGN(32) unsigned char states[MAX_PARALLELISM*STATE_BYTES];
+    ALIGN(16) unsigned char single[MAX_PARALLELISM][STATE_BYTES];
+    unsigned char data[STATE_BYTES], input[STATE_BYTES];
+    unsigned char expected[STATE_BYTES], actual[STATE_BYTES];
+    unsigned int i, round, offset, length;
+    int errors = 0;
+
+    p->InitializeAll(states);
+    for (i = 0; i < p->parallelism; i++)
+        Xoodoo_Initialize(single[i]);
+
+    for (round = 0; round < 64; round++) {
+        for (i = 0; i < p->parallelism; i++) {
+            /* Unaligned pieces, so that partial lanes get exercised */
+            offset = randomByte() % STATE_BYTES;
+            length = randomByte() % (STATE_BYTES - offset + 1);
+            randomBytes(data, length);
+            if (round % 4 == 3) {
+                p->OverwriteBytes(states, i, data, offset, length);
+                Xoodoo_OverwriteBytes(single[i], data, offset, length);
+            }
+            else {
+                p->AddBytes(states, i, data, offset, length);
+                Xoodoo_AddBytes(single[i], data, offset, length);
+            }
+            data[0] = randomByte();
+            offset = randomByte() % STATE_BYTES;
+            p->AddByte(states, i, data[0], offset);
+            Xoodoo_AddByte(single[i], data[0], offset);
+        }
+
+        if (round % 2) {
+            p->PermuteAll_6rounds(states);
+            for (i = 0; i < p->parallelism; i++)
+                Xoodoo_Permute_6rounds(single[i]);
+        }
+        else {
+            p->PermuteAll_12rounds(states);
+            for (i = 0; i < p->parallelism; i++)
+                Xoodoo_Permute_12rounds(single[i]);
+        }
+
+        for (i = 0; i < p->parallelism; i++) {
+            offset = randomByte() % STATE_BYTES;
+            length = STATE_BYTES - offset;
+            randomBytes(input, length);
+            if (round % 2) {
+                p->ExtractAndAddBytes(states, i, input, actual, offset, length);
+                Xoodoo_ExtractAndAddBytes(single[i], input, expected, offset, length);
+            }
+            else {
+                p->ExtractBytes(states, i, actual, offset, length);
+                Xoodoo_ExtractBytes(single[i], expected, offset, length);
+            }
+            if (memcmp(actual, expected, length) != 0) {
+                printf("%s: instance %u differs after %u permutations\n",
+                    p->name, i, round + 1);
+                errors++;
+            }
+        }
+    }
+
+    return errors;
+}
+
+int main(void)
+{
+    int errors = 0;
+
+    Xoodoo_StaticInitialize();
+    Xoodootimes4_StaticInitialize();
+    errors += testPlSnP(&times4);
+
+    if (__builtin_cpu_supports("avx2")) {
+        Xoodootimes8_StaticInitialize();
+        errors += testPlSnP(&times8);
+    }
+    else {
+        printf("Xoodootimes8: skipped, AVX2 is not supported\n");
+    }
+
+    printf("%s\n", errors ? "WRONG!" : "CORRECT!");
+    return errors != 0;
+}
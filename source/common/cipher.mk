@@ -28,13 +28,17 @@
 # Call this makefile from a cipher source directory to build  the given cipher:
 #	make -f ./../../../common/cipher.mk [ARCHITECTURE=[AVR|MSP|ARM|PC]]
 #		[DEBUG=[0|1|3|7]] [MEASURE_CYCLE_COUNT=[0|1]]
-#		[COMPILER_OPTIONS='...'] [all|clean|help]
+#		[COMPILER_OPTIONS='...'] [all|test|clean|help]
 #
 # 	Examples: 
 #		make -f ./../../../common/cipher.mk
 #		make -f ./../../../common/cipher.mk ARCHITECTURE=PC DEBUG=1
+#		make -f ./../../../common/cipher.mk ARCHITECTURE=PC test
 #		make -f ./../../../common/cipher.mk clean
 #
+# The test target builds the cipher sources along with the programs found in
+# the test directory of the cipher, if any, and runs them on the host.
+#
 
 
 SOURCEDIR = ./../source
@@ -51,6 +55,10 @@ SOURCES = $(wildcard $(SOURCEDIR)/*.c)
 SOURCES_ASM = $(wildcard $(SOURCEDIR)/*.S)
 OBJS = $(subst $(SOURCEDIR)/, , $(SOURCES:.c=.o) $(SOURCES_ASM:.S=.o))
 
+TESTDIR = ./../test
+TEST_SOURCES = $(wildcard $(TESTDIR)/*.c)
+TEST_OBJS = $(subst $(TESTDIR)/, test_, $(TEST_SOURCES:.c=.o))
+
 BENCH_SOURCES = $(COMMONSOURCEDIR)/felics/main_bench.c
 BENCH_OBJECTS = $(subst $(COMMONSOURCEDIR)/felics/, felics_, $(BENCH_SOURCES:.c=.o))
 
@@ -79,7 +87,7 @@ CIPHERNAME = $(lastword $(subst $(LASTCURRENTPATHDIR), , $(CURRENTPATHDIRS)))
 DELIMITER = ----------
 
 
-.PHONY : all clean help
+.PHONY : all test clean help
 
 
 all : post-build
@@ -171,6 +179,17 @@ felics_bench.elf : \
 		felics_common.o
 	$(CC) $(LDFLAGS) $(addprefix $(BUILDDIR)/, $^) $(LDLIBS) -o $(BUILDDIR)/$@
 
+test : \
+		pre-build \
+		felics_test.elf
+	$(BUILDDIR)/felics_test.elf
+
+felics_test.elf : \
+		$(OBJS) \
+		$(TEST_OBJS) \
+		felics_common.o
+	$(CC) $(LDFLAGS) $(addprefix $(BUILDDIR)/, $^) $(LDLIBS) -o $(BUILDDIR)/$@
+
 %.bin: $(BUILDDIR)/%.elf
 	$(OBJCOPY) -O binary $< $@
 
@@ -198,6 +217,13 @@ felics_%.o: $(COMMONSOURCEDIR)/felics/%.c       \
             | $(BUILDDIR)
 	$(CC) -c $(CFLAGS) $< $(INCLUDES) -o $(BUILDDIR)/$@
 
+test_%.o: $(TESTDIR)/%.c                        \
+          $(COMMONSOURCEDIR)/felics/cipher.h    \
+          $(COMMONSOURCEDIR)/felics/common.h    \
+          $(SOURCEDIR)/api.h                    \
+          | $(BUILDDIR)
+	$(CC) -c $(CFLAGS) $< $(INCLUDES) -o $(BUILDDIR)/$@
+
 felics_check.lst felics_bench.lst: %.lst: %.elf | $(BUILDDIR)
 	$(OBJDUMP) $(OBJDUMPFLAGS) $(BUILDDIR)/$< > $(BUILDDIR)/$@
 
@@ -217,11 +243,12 @@ help:
 	@echo -n "	make -f ./../../../common/cipher.mk "
 	@echo -n		"[ARCHITECTURE=[AVR|MSP|ARM|PC|NRF52840|STM32L053]] [DEBUG=[0|1|3|7]] "
 	@echo -n		"[MEASURE_CYCLE_COUNT=[0|1]] [SCENARIO=[0|1]] "
-	@echo -n		"[COMPILER_OPTIONS='...'] [all|clean|help]"
+	@echo -n		"[COMPILER_OPTIONS='...'] [all|test|clean|help]"
 	@echo ""
 	@echo ""
 	@echo " 	Examples: "
 	@echo "		make -f ./../../../common/cipher.mk"
 	@echo "		make -f ./../../../common/cipher.mk ARCHITECTURE=PC"
+	@echo "		make -f ./../../../common/cipher.mk ARCHITECTURE=PC test"
 	@echo "		make -f ./../../../common/cipher.mk clean"
 	@echo ""
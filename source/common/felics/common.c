@@ -78,6 +78,12 @@
 
 
 #include "felics/cipher.h"
+
+#if defined(MEASURE_CYCLE_COUNT) && \
+	(MEASURE_CYCLE_COUNT_ENABLED == MEASURE_CYCLE_COUNT)
+#include <stdio.h>
+#endif
+
 #include "felics/common.h"
 #include "felics/test_vectors.h"
 #include "api.h"
@@ -184,10 +190,34 @@ void VerifyData(uint8_t *data, const char *name)
 #endif
 
 
+void ResetRandomBytesCount()
+{
+	if (&RandomBytesCount != NULL)
+	{
+		RandomBytesCount = 0;
+	}
+}
+
+#if (defined(DEBUG) && (DEBUG_LOW == (DEBUG_LOW & DEBUG))) || \
+	(defined(MEASURE_CYCLE_COUNT) && \
+	(MEASURE_CYCLE_COUNT_ENABLED == MEASURE_CYCLE_COUNT))
+
+void DisplayRandomBytesCount(const char *operation)
+{
+	if (&RandomBytesCount != NULL)
+	{
+		printf("%sRandomBytes: %lu\n", operation,
+			(unsigned long)RandomBytesCount);
+	}
+}
+
+#endif
+
 void BeginEncryption()
 {
 #if defined(DEBUG) && (DEBUG_LOW == (DEBUG_LOW & DEBUG))
 	printf("->Encryption begin\n");
+	ResetRandomBytesCount();
 #endif
 }
 
@@ -195,6 +225,7 @@ void EndEncryption()
 {
 #if defined(DEBUG) && (DEBUG_LOW == (DEBUG_LOW & DEBUG))
 	printf("->Encryption end\n");
+	DisplayRandomBytesCount("Encrypt");
 #endif
 }
 
@@ -202,6 +233,7 @@ void BeginDecryption()
 {
 #if defined(DEBUG) && (DEBUG_LOW == (DEBUG_LOW & DEBUG))
 	printf("->Decryption begin\n");
+	ResetRandomBytesCount();
 #endif
 }
 
@@ -209,6 +241,7 @@ void EndDecryption()
 {
 #if defined(DEBUG) && (DEBUG_LOW == (DEBUG_LOW & DEBUG))
 	printf("->Decryption end\n");
+	DisplayRandomBytesCount("Decrypt");
 #endif
 }
 
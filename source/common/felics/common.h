@@ -97,21 +97,50 @@ void VerifyTag(uint8_t tag_check);
 #endif /* DEBUG */
 
 
+/*
+ *
+ * Number of random bytes drawn during the current operation; only
+ * implementations which consume randomness (e.g. masked implementations)
+ * define this counter
+ *
+ */
+extern uint32_t RandomBytesCount __attribute__((weak));
+
+/*
+ *
+ * Reset the random bytes counter, if the implementation defines it
+ *
+ */
+void ResetRandomBytesCount();
+
+/*
+ *
+ * Display the random bytes counter as "<operation>RandomBytes: <count>", if
+ * the implementation defines it; available in debug builds and when the
+ * cycle count is measured
+ * ... operation - "Encrypt" or "Decrypt"
+ *
+ */
+void DisplayRandomBytesCount(const char *operation);
+
+
 
 #ifdef ARM /* ARM */
 
 #if defined(MEASURE_CYCLE_COUNT) && \
 	(MEASURE_CYCLE_COUNT_ENABLED == MEASURE_CYCLE_COUNT) /* MEASURE_CYCLE_COUNT */
 
-#define BEGIN_ENCRYPTION() CYCLE_COUNT_START
+#define BEGIN_ENCRYPTION() ResetRandomBytesCount(); CYCLE_COUNT_START
 #define END_ENCRYPTION() \
 	CYCLE_COUNT_STOP; \
-	printf("EncryptCycleCount: %u\n", CYCLE_COUNT_ELAPSED)
+	printf("EncryptCycleCount: %u\n", CYCLE_COUNT_ELAPSED); \
+	DisplayRandomBytesCount("Encrypt")
 
-#define BEGIN_DECRYPTION() CYCLE_COUNT_START
+#define BEGIN_DECRYPTION() ResetRandomBytesCount(); CYCLE_COUNT_START
 #define END_DECRYPTION() \
 	CYCLE_COUNT_STOP; \
-	printf("DecryptCycleCount: %u\n", CYCLE_COUNT_ELAPSED)
+	printf("DecryptCycleCount: %u\n", CYCLE_COUNT_ELAPSED); \
+	DisplayRandomBytesCount("Decrypt")
 
 #define DONE() printf("Done\n")
 
@@ -138,15 +167,17 @@ void VerifyTag(uint8_t tag_check);
 #if defined(MEASURE_CYCLE_COUNT) && \
 	(MEASURE_CYCLE_COUNT_ENABLED == MEASURE_CYCLE_COUNT) /* MEASURE_CYCLE_COUNT */
 
-#define BEGIN_ENCRYPTION() cycleCountStart()
+#define BEGIN_ENCRYPTION() ResetRandomBytesCount(); cycleCountStart()
 #define END_ENCRYPTION() \
 	cycleCountStop(); \
-	printf("EncryptCycleCount: %u\n", cycleCountElapsed())
+	printf("EncryptCycleCount: %u\n", cycleCountElapsed()); \
+	DisplayRandomBytesCount("Encrypt")
 
-#define BEGIN_DECRYPTION() cycleCountStart()
+#define BEGIN_DECRYPTION() ResetRandomBytesCount(); cycleCountStart()
 #define END_DECRYPTION() \
 	cycleCountStop(); \
-	printf("DecryptCycleCount: %u\n", cycleCountElapsed())
+	printf("DecryptCycleCount: %u\n", cycleCountElapsed()); \
+	DisplayRandomBytesCount("Decrypt")
 
 #define DONE() printf("Done\n")
 
@@ -174,15 +205,17 @@ void VerifyTag(uint8_t tag_check);
 #if defined(MEASURE_CYCLE_COUNT) && \
 	(MEASURE_CYCLE_COUNT_ENABLED == MEASURE_CYCLE_COUNT) /* MEASURE_CYCLE_COUNT */
 
-#define BEGIN_ENCRYPTION() CYCLE_COUNT_START
+#define BEGIN_ENCRYPTION() ResetRandomBytesCount(); CYCLE_COUNT_START
 #define END_ENCRYPTION() \
 	CYCLE_COUNT_STOP; \
-	printf("EncryptCycleCount: %u\n", CYCLE_COUNT_ELAPSED)
+	printf("EncryptCycleCount: %u\n", CYCLE_COUNT_ELAPSED); \
+	DisplayRandomBytesCount("Encrypt")
 
-#define BEGIN_DECRYPTION() CYCLE_COUNT_START
+#define BEGIN_DECRYPTION() ResetRandomBytesCount(); CYCLE_COUNT_START
 #define END_DECRYPTION() \
 	CYCLE_COUNT_STOP; \
-	printf("DecryptCycleCount: %u\n", CYCLE_COUNT_ELAPSED)
+	printf("DecryptCycleCount: %u\n", CYCLE_COUNT_ELAPSED); \
+	DisplayRandomBytesCount("Decrypt")
 
 #define DONE() printf("Done\n")
 
@@ -210,15 +243,17 @@ void VerifyTag(uint8_t tag_check);
 #if defined(MEASURE_CYCLE_COUNT) && \
 	(MEASURE_CYCLE_COUNT_ENABLED == MEASURE_CYCLE_COUNT) /* MEASURE_CYCLE_COUNT */
 
-#define BEGIN_ENCRYPTION() CYCLE_COUNT_START
+#define BEGIN_ENCRYPTION() ResetRandomBytesCount(); CYCLE_COUNT_START
 #define END_ENCRYPTION() \
 	CYCLE_COUNT_STOP; \
-	printf("EncryptCycleCount: %"PRIu64"\n", CYCLE_COUNT_ELAPSED)
+	printf("EncryptCycleCount: %"PRIu64"\n", CYCLE_COUNT_ELAPSED); \
+	DisplayRandomBytesCount("Encrypt")
 
-#define BEGIN_DECRYPTION() CYCLE_COUNT_START
+#define BEGIN_DECRYPTION() ResetRandomBytesCount(); CYCLE_COUNT_START
 #define END_DECRYPTION() \
 	CYCLE_COUNT_STOP; \
-	printf("DecryptCycleCount: %"PRIu64"\n", CYCLE_COUNT_ELAPSED)
+	printf("DecryptCycleCount: %"PRIu64"\n", CYCLE_COUNT_ELAPSED); \
+	DisplayRandomBytesCount("Decrypt")
 
 #define DONE()
 
@@ -236,10 +271,12 @@ void VerifyTag(uint8_t tag_check);
 
 #else /* PC */
 
-#define BEGIN_ENCRYPTION() BeginEncryption()
+/* The simulator scripts read RandomBytesCount back at the EndEncryption and
+ * EndDecryption breakpoints. */
+#define BEGIN_ENCRYPTION() ResetRandomBytesCount(); BeginEncryption()
 #define END_ENCRYPTION() EndEncryption()
 
-#define BEGIN_DECRYPTION() BeginDecryption()
+#define BEGIN_DECRYPTION() ResetRandomBytesCount(); BeginDecryption()
 #define END_DECRYPTION() EndDecryption()
 
 #define DONE()
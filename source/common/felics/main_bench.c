@@ -36,6 +36,7 @@
 
 #if defined(PC)
 #include <inttypes.h>
+#include <stdio.h>
 #include "cycleCount.h"
 #endif /* PC */
 